@@ -0,0 +1,165 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_ALLOCATOR_H
+#define GHO_ALLOCATOR_H
+
+#include <stddef.h>
+
+#include "memory.h"
+
+
+/**
+ * \defgroup gho_allocator gho_allocator
+ * \brief Arena and pool allocators for gho_alloc and gho_array_alloc
+ *
+ * A gho_arena_t takes the blocks in big chunks and frees them all at once in
+ * gho_arena_destroy: it is made for the short-lived temporaries of a phase
+ * (parsing, printing).
+ * A gho_pool_t has one free list by size class (powers of 2 from 32 bytes to
+ * gho_pool_size_max bytes); the bigger blocks are allocated with malloc.
+ *
+ * Usage:
+ * @code
+   gho_arena_t arena = gho_arena_create();
+   gho_allocator_t* previous = gho_allocator_set(&arena.allocator);
+   // gho_alloc, gho_array_alloc, gho_array_realloc use the arena
+   gho_allocator_set(previous);
+   // Destroy the objects (or not) then
+   gho_arena_destroy(&arena);
+   @endcode
+ * An arena or a pool must not be moved (copied) after its first allocation.
+ */
+
+/**
+ * \brief Chunk of a gho_arena_t (followed by its memory)
+ * @ingroup gho_allocator
+ */
+typedef struct gho_arena_chunk_s {
+  
+  /// \brief Previous chunk
+  struct gho_arena_chunk_s* previous;
+  
+  /// \brief Size of the memory of the chunk (bytes)
+  size_t size;
+  
+  /// \brief Size used (bytes)
+  size_t used;
+  
+  /// \brief Alignment of the memory after the chunk
+  gho_memory_header_t alignment;
+  
+} gho_arena_chunk_t;
+
+/**
+ * \brief Arena allocator: the memory is released all at once
+ * @ingroup gho_allocator
+ */
+typedef struct {
+  
+  /// \brief Allocator (gho_allocator_set(&arena.allocator))
+  gho_allocator_t allocator;
+  
+  /// \brief Last chunk allocated (the current one)
+  gho_arena_chunk_t* chunk;
+  
+  /// \brief Minimal size of a chunk (bytes)
+  size_t chunk_size;
+  
+} gho_arena_t;
+
+#ifndef gho_arena_chunk_size
+  /**
+   * \brief Default size of a chunk of a gho_arena_t (bytes)
+   *        (can be defined before including gho)
+   * @ingroup gho_allocator
+   */
+  #define gho_arena_chunk_size ((size_t)1 << 16)
+#endif
+
+#ifndef gho_pool_size_max
+  /**
+   * \brief Size of the biggest size class of a gho_pool_t (bytes, power of 2)
+   *        (can be defined before including gho)
+   * @ingroup gho_allocator
+   */
+  #define gho_pool_size_max ((size_t)4096)
+#endif
+
+/**
+ * \brief Size of the smallest size class of a gho_pool_t (bytes)
+ * @ingroup gho_allocator
+ */
+#define gho_pool_size_min ((size_t)32)
+
+/**
+ * \brief Maximal number of size classes of a gho_pool_t
+ * @ingroup gho_allocator
+ */
+#define gho_pool_nb_class_max 32
+
+/**
+ * \brief Pool allocator: one free list by size class
+ * @ingroup gho_allocator
+ */
+typedef struct {
+  
+  /// \brief Allocator (gho_allocator_set(&pool.allocator))
+  gho_allocator_t allocator;
+  
+  /// \brief Free blocks of each size class (the first bytes are the next one)
+  void* free_list[gho_pool_nb_class_max];
+  
+  /// \brief Memory of the blocks of the size classes
+  gho_arena_t arena;
+  
+} gho_pool_t;
+
+
+// Arena
+static inline
+gho_arena_t gho_arena_create();
+static inline
+void gho_arena_destroy(gho_arena_t* arena);
+static inline
+void gho_arena_reset(gho_arena_t* arena);
+static inline
+void* gho_arena_alloc_(gho_allocator_t* allocator, const size_t size);
+static inline
+void* gho_arena_realloc_(gho_allocator_t* allocator, void* p,
+                         const size_t old_size, const size_t size);
+static inline
+void gho_arena_free_(gho_allocator_t* allocator, void* p, const size_t size);
+
+// Pool
+static inline
+gho_pool_t gho_pool_create();
+static inline
+void gho_pool_destroy(gho_pool_t* pool);
+static inline
+void gho_pool_reset(gho_pool_t* pool);
+static inline
+size_t gho_pool_class_(const size_t size);
+static inline
+void* gho_pool_alloc_(gho_allocator_t* allocator, const size_t size);
+static inline
+void* gho_pool_realloc_(gho_allocator_t* allocator, void* p,
+                        const size_t old_size, const size_t size);
+static inline
+void gho_pool_free_(gho_allocator_t* allocator, void* p, const size_t size);
+
+#include "implementation/allocator.h"
+
+#endif
@@ -24,6 +24,7 @@
 #include "string.h"
 #include "type.h"
 #include "memory.h"
+#include "binary.h"
 
 
 // Typedef for functions
@@ -33,17 +34,15 @@ typedef void (*gho_sprinti_fct_t)(char**, const void* const, const unsigned int)
 typedef void (*gho_copy_fct_t)(const void* const, void*);
 typedef bool (*gho_equal_fct_t)(const void* const, const void* const);
 typedef gho_string_t (*gho_to_string_fct_t)(const void* const);
+typedef void (*gho_fwrite_bin_fct_t)(FILE*, const void* const);
 
 /**
- * \brief Contains any structure
+ * \brief Type, size and functions of the structures of a type
  * 
- * gho_any_t can hold any struct.
+ * The gho_*_to_any functions use one static gho_any_vtable_t by type.
  */
 typedef struct {
   
-  /// \brief Structure
-  void* any;
-  
   /// \brief Type of the structure
   gho_type_t type;
   
@@ -68,6 +67,41 @@ typedef struct {
   /// \brief to_string function
   gho_to_string_fct_t to_string_fct;
   
+  /// \brief fwrite_bin function (NULL if there is no binary format or if
+  ///        gho_any_fread_bin can not read the type)
+  gho_fwrite_bin_fct_t fwrite_bin_fct;
+  
+} gho_any_vtable_t;
+
+/**
+ * \brief Size of the buffer of a gho_any_t: a smaller structure is stored in
+ *        the gho_any_t, a bigger one is allocated
+ */
+#define gho_any_buffer_size (4 * sizeof(void*))
+
+/**
+ * \brief Contains any structure
+ * 
+ * gho_any_t can hold any struct.
+ * Use gho_any_data and gho_any_cdata to access to the structure.
+ */
+typedef struct {
+  
+  /// \brief Type, size and functions (NULL if the gho_any_t is empty)
+  const gho_any_vtable_t* vtable;
+  
+  /// \brief Structure (in buffer if it fits, allocated in p otherwise)
+  union {
+    /// \brief Allocated structure
+    void* p;
+    /// \brief Alignment of the buffer
+    long long int alignment;
+    /// \brief Alignment of the buffer
+    double alignment_double;
+    /// \brief Structure stored in the gho_any_t
+    char buffer[gho_any_buffer_size];
+  } any;
+  
 } gho_any_t;
 
 
@@ -78,6 +112,18 @@ static inline
 void gho_any_destroy(gho_any_t* any);
 static inline
 void gho_any_reset(gho_any_t* any);
+static inline
+gho_any_t gho_any_create_(const gho_any_vtable_t* const vtable);
+
+// Structure
+static inline
+bool gho_any_is_inline_(const gho_any_vtable_t* const vtable);
+static inline
+void* gho_any_data(gho_any_t* any);
+static inline
+const void* gho_any_cdata(const gho_any_t* const any);
+static inline
+gho_type_t gho_any_type(const gho_any_t* const any);
 
 // Output
 static inline
@@ -92,6 +138,8 @@ void gho_any_sprinti(char** c_str, const gho_any_t* const any,
                      const unsigned int indent);
 static inline
 void gho_any_sprint(char** c_str, const gho_any_t* const any);
+static inline
+void gho_any_fwrite_bin(FILE* file, const gho_any_t* const any);
 
 // Copy & comparisons
 static inline
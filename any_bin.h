@@ -0,0 +1,38 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_ANY_BIN_H
+#define GHO_ANY_BIN_H
+
+#include <stdio.h>
+
+#include "any.h"
+#include "binary.h"
+#include "char.h"
+#include "string.h"
+#include "start_and_size.h"
+#include "int.h"
+#include "int/ullint.h"
+
+
+// Input
+static inline
+gho_any_t gho_any_fread_bin(FILE* file);
+static inline
+void gho_any_fread_bin_(FILE* file, gho_any_t* any);
+
+#include "implementation/any_bin.h"
+
+#endif
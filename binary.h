@@ -0,0 +1,79 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_BINARY_H
+#define GHO_BINARY_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "type.h"
+
+
+/**
+ * \defgroup gho_binary gho_binary
+ * \brief Binary format
+ *
+ * The gho_*_fwrite_bin functions write a compact binary format, read back by
+ * the gho_*_fread_bin functions:
+ * - integers are written as little-endian blocks of sizeof(T) bytes;
+ * - sizes are written on 8 bytes (little-endian);
+ * - C strings and gho_string_t are written as a size and the chars;
+ * - gho_mpz_t are written as a sign, a size and the bytes of the absolute
+ *   value (least significant byte first, mpz_export);
+ * - vectors, matrices and gho_any_t start with a header: "gho" and a 0,
+ *   the version (gho_binary_version), the gho_type_t of the object and the
+ *   size of an element when the elements are written as a raw block (0
+ *   otherwise), each on 4 bytes.
+ */
+
+
+/**
+ * \brief Version of the binary format
+ * @ingroup gho_binary
+ */
+#define gho_binary_version 1u
+
+
+// Header
+static inline
+void gho_binary_fwrite_header(FILE* file, const gho_type_t type,
+                              const size_t element_size);
+static inline
+void gho_binary_fread_header(FILE* file, const gho_type_t type,
+                             const size_t element_size);
+static inline
+gho_type_t gho_binary_fread_header_type(FILE* file, size_t* element_size);
+
+// Block
+static inline
+bool gho_binary_little_endian();
+static inline
+void gho_binary_fwrite_block(FILE* file, const void* const data,
+                             const size_t element_size, const size_t n);
+static inline
+void gho_binary_fread_block(FILE* file, void* data,
+                            const size_t element_size, const size_t n);
+
+// Size
+static inline
+void gho_binary_fwrite_size(FILE* file, const size_t size);
+static inline
+size_t gho_binary_fread_size(FILE* file);
+
+#include "implementation/binary.h"
+
+#endif
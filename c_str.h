@@ -19,11 +19,22 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "reader.h"
+#include "binary.h"
+#include "hash.h"
+#include "search.h"
+
 
 // Consider C string type as a class in Doxygen
 #ifdef DOXYGEN
 
-  /// @brief Typedef for C string (char*)
+  /**
+   * @brief Typedef for C string (char*)
+   *
+   * The C strings returned by gho are allocated with gho_malloc: free them
+   * with gho_c_str_destroy (or gho_free), never with free. A C string of
+   * malloc can be moved in a gho_string_t with gho_string_absorb_malloc_c_str.
+   */
   struct gho_c_str_t { };
 
 #else
@@ -56,12 +67,18 @@ void gho_c_str_sprinti(char** out, const char* const c_str,
                        const unsigned int indent);
 static inline
 void gho_c_str_sprint(char** out, const char* const c_str);
+static inline
+void gho_c_str_fwrite_bin(FILE* file, const char* const c_str);
 
 // Input
 static inline
 char* gho_c_str_fread(FILE* file);
 static inline
 char* gho_c_str_sread(const char** c_str);
+static inline
+char* gho_c_str_rread(gho_reader_t* reader);
+static inline
+char* gho_c_str_fread_bin(FILE* file);
 
 // Copy & comparisons
 static inline
@@ -70,6 +87,8 @@ static inline
 bool gho_c_str_equal(const char* const a, const char* const b);
 static inline
 int gho_c_str_compare(const char* const a, const char* const b);
+static inline
+size_t gho_c_str_hash(const char* const c_str);
 
 // Size
 static inline
@@ -81,6 +100,9 @@ bool gho_c_str_empty(const char* const c_str);
 static inline
 void gho_c_str_add(char** c_str, const char* const to_be_added);
 static inline
+void gho_c_str_add_n(char** c_str, const char* const to_be_added,
+                     const size_t n);
+static inline
 void gho_c_str_add_char(char** c_str, const char to_be_added);
 static inline
 void gho_c_str_add_char_i(char** c_str, const char to_be_added,
@@ -98,6 +120,15 @@ size_t gho_c_str_find(const char* const c_str, const char* const value);
 static inline
 size_t gho_c_str_find_char(const char* const c_str, const char value);
 static inline
+size_t gho_c_str_find_from(const char* const c_str, const char* const value,
+                           const size_t i);
+static inline
+size_t gho_c_str_rfind(const char* const c_str, const char* const value);
+static inline
+size_t gho_c_str_rfind_char(const char* const c_str, const char value);
+static inline
+size_t gho_c_str_count(const char* const c_str, const char* const value);
+static inline
 bool gho_c_str_contains(const char* const c_str, const char* const value);
 
 // Get line
@@ -128,6 +159,21 @@ void gho_c_str_ignore_line_from_c_str_delimiter(const char** c_str,
 static inline
 char* gho_c_str_peek_line_from_c_str_delimiter(const char** c_str,
                                                const char delimiter);
+static inline
+char* gho_c_str_get_line_from_reader(gho_reader_t* reader);
+static inline
+void gho_c_str_ignore_line_from_reader(gho_reader_t* reader);
+static inline
+char* gho_c_str_peek_line_from_reader(gho_reader_t* reader);
+static inline
+char* gho_c_str_get_line_from_reader_delimiter(gho_reader_t* reader,
+                                               const char delimiter);
+static inline
+void gho_c_str_ignore_line_from_reader_delimiter(gho_reader_t* reader,
+                                                 const char delimiter);
+static inline
+char* gho_c_str_peek_line_from_reader_delimiter(gho_reader_t* reader,
+                                                const char delimiter);
 
 #include "implementation/c_str.h"
 
@@ -21,6 +21,9 @@
 
 #include "string.h"
 #include "any.h"
+#include "binary.h"
+#include "reader.h"
+#include "hash.h"
 
 
 // Consider C char type as a class in Doxygen
@@ -58,12 +61,20 @@ void gho_char_sprinti(char** c_str, const char* const c,
                       const unsigned int indent);
 static inline
 void gho_char_sprint(char** c_str, const char* const c);
+static inline
+void gho_char_fwrite_bin(FILE* file, const char* const c);
 
 // Input
 static inline
 char gho_char_fread(FILE* file);
 static inline
 char gho_char_sread(const char** c_str);
+static inline
+char gho_char_rread(gho_reader_t* reader);
+static inline
+char gho_char_fread_bin(FILE* file);
+static inline
+void gho_char_fread_bin_(FILE* file, char* c);
 
 // Copy & comparisons
 static inline
@@ -74,6 +85,8 @@ static inline
 bool gho_char_equal(const char* const a, const char* const b);
 static inline
 int gho_char_compare(const char* const a, const char* const b);
+static inline
+size_t gho_char_hash(const char* const c);
 
 // Conversion
 static inline
@@ -86,6 +99,8 @@ static inline
 char gho_char_fpeek(FILE* file);
 static inline
 char gho_char_speek(const char** c_str);
+static inline
+char gho_char_rpeek(gho_reader_t* reader);
 
 #include "implementation/char.h"
 
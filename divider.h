@@ -0,0 +1,100 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_DIVIDER_H
+#define GHO_DIVIDER_H
+
+#include <stdbool.h>
+
+#include "int/llint.h"
+#include "int/ullint.h"
+
+
+/**
+ * \brief Division by a fixed divisor
+ *
+ * The division of |n| by |d| is a multiplication by a magic number followed
+ * by a shift (Granlund and Montgomery, "Division by invariant integers using
+ * multiplication", as in libdivide), the exact division is a multiplication
+ * by the inverse of the odd part of |d| modulo 2^64. Create a gho_divider_t
+ * once and use it to divide many values by d.
+ */
+typedef struct {
+  
+  /// \brief Divisor
+  gho_llint d;
+  
+  /// \brief |d|
+  gho_ullint d_abs;
+  
+  /// \brief Magic multiplier, 0 if |d| is a power of 2
+  gho_ullint magic;
+  
+  /// \brief Shift applied after the multiplication
+  int shift;
+  
+  /// \brief true if the magic multiplier needs 65 bits (its 65th bit is
+  ///        implicit)
+  bool add;
+  
+  /// \brief Number of trailing zeros of |d|
+  int ctz;
+  
+  /// \brief Inverse of the odd part of |d| modulo 2^64
+  gho_ullint inverse;
+  
+} gho_divider_t;
+
+
+// Create
+static inline
+gho_divider_t gho_divider_create(const gho_llint d);
+
+// Division
+static inline
+gho_llint gho_divider_floor_div_q(const gho_divider_t* const divider,
+                                  const gho_llint n);
+static inline
+gho_llint gho_divider_floor_div_r(const gho_divider_t* const divider,
+                                  const gho_llint n);
+static inline
+gho_llint gho_divider_div_exact(const gho_divider_t* const divider,
+                                const gho_llint n);
+static inline
+gho_llint gho_divider_mod(const gho_divider_t* const divider,
+                          const gho_llint n);
+
+// Division of |n| (the results are returned modulo 2^64)
+static inline
+gho_ullint gho_divider_div_abs_(const gho_divider_t* const divider,
+                                const gho_ullint n_abs);
+static inline
+gho_ullint gho_divider_floor_div_q_(const gho_divider_t* const divider,
+                                    const gho_ullint n_abs, const bool n_neg);
+static inline
+gho_ullint gho_divider_floor_div_r_(const gho_divider_t* const divider,
+                                    const gho_ullint n_abs, const bool n_neg);
+static inline
+gho_ullint gho_divider_div_exact_(const gho_divider_t* const divider,
+                                  const gho_ullint n_abs, const bool n_neg);
+static inline
+gho_ullint gho_divider_mod_(const gho_divider_t* const divider,
+                            const gho_ullint n_abs, const bool n_neg);
+static inline
+gho_ullint gho_divider_mul_hi_(const gho_ullint a, const gho_ullint b);
+
+#include "implementation/divider.h"
+
+#endif
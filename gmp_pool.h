@@ -0,0 +1,142 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_GMP_POOL_H
+#define GHO_GMP_POOL_H
+
+#ifdef gho_with_gmp
+
+#include <stddef.h>
+
+#include "gmp.h"
+
+
+/**
+ * \defgroup gho_gmp_pool gho_gmp_pool
+ * \brief Pool of GMP limbs
+ *
+ * gho_gmp_memory_functions_install replaces the GMP memory functions
+ * (mp_set_memory_functions) by functions which put a tag before each block,
+ * it has to be called before any other GMP function.
+ * Then, the limbs of the mpz_t created with a gho_gmp_pool_t are taken in the
+ * big chunks of the pool: mpz_clear does not free them, they are released all
+ * at once by gho_gmp_pool_destroy (after the destruction of the mpz_t). If a
+ * mpz_t of a pool needs more limbs, GMP reallocates it outside of the pool.
+ */
+
+/**
+ * \brief Tag before each block allocated by the gho GMP memory functions
+ * @ingroup gho_gmp_pool
+ */
+typedef union {
+  
+  /// \brief GHO_GMP_BLOCK_MALLOC or GHO_GMP_BLOCK_POOL
+  size_t tag;
+  
+  /// \brief Alignment of the block after the tag (as malloc)
+  long double alignment;
+  
+} gho_gmp_block_header_t;
+
+/**
+ * \brief Tag of a block allocated with malloc
+ * @ingroup gho_gmp_pool
+ */
+#define GHO_GMP_BLOCK_MALLOC ((size_t)0x6D616C6C)
+
+/**
+ * \brief Tag of a block allocated in a gho_gmp_pool_t
+ * @ingroup gho_gmp_pool
+ */
+#define GHO_GMP_BLOCK_POOL ((size_t)0x706F6F6C)
+
+/**
+ * \brief Chunk of a gho_gmp_pool_t (followed by its memory)
+ * @ingroup gho_gmp_pool
+ */
+typedef struct gho_gmp_pool_chunk_s {
+  
+  /// \brief Previous chunk
+  struct gho_gmp_pool_chunk_s* previous;
+  
+  /// \brief Size of the memory of the chunk (bytes)
+  size_t size;
+  
+  /// \brief Size used (bytes)
+  size_t used;
+  
+  /// \brief Alignment of the memory after the chunk
+  gho_gmp_block_header_t alignment;
+  
+} gho_gmp_pool_chunk_t;
+
+/**
+ * \brief Pool of GMP limbs released all at once
+ * @ingroup gho_gmp_pool
+ */
+typedef struct {
+  
+  /// \brief Last chunk allocated (the current one)
+  gho_gmp_pool_chunk_t* chunk;
+  
+  /// \brief Minimal size of a chunk (bytes)
+  size_t chunk_size;
+  
+} gho_gmp_pool_t;
+
+#ifndef gho_gmp_pool_chunk_size
+  /**
+   * \brief Default size of a chunk of a gho_gmp_pool_t (bytes)
+   *        (can be defined before including gho)
+   * @ingroup gho_gmp_pool
+   */
+  #define gho_gmp_pool_chunk_size ((size_t)1 << 20)
+#endif
+
+
+// GMP memory functions
+static inline
+void gho_gmp_memory_functions_install();
+static inline
+void* gho_gmp_alloc_(size_t size);
+static inline
+void* gho_gmp_realloc_(void* p, size_t old_size, size_t new_size);
+static inline
+void gho_gmp_free_(void* p, size_t size);
+static inline
+void gho_gmp_free(void* p, size_t size);
+
+// Create & destroy
+static inline
+gho_gmp_pool_t gho_gmp_pool_create();
+static inline
+void gho_gmp_pool_destroy(gho_gmp_pool_t* pool);
+static inline
+void gho_gmp_pool_reset(gho_gmp_pool_t* pool);
+
+// Allocation
+static inline
+void* gho_gmp_pool_alloc(gho_gmp_pool_t* pool, const size_t size);
+static inline
+void gho_gmp_pool_mpz_init(gho_gmp_pool_t* pool, mpz_t i,
+                           const size_t nb_limb);
+static inline
+void gho_gmp_pool_mpz_init_set(gho_gmp_pool_t* pool, mpz_t r, const mpz_t i);
+
+#include "implementation/gmp_pool.h"
+
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_HASH_H
+#define GHO_HASH_H
+
+#include <stddef.h>
+
+
+/**
+ * \defgroup gho_hash gho_hash
+ * \brief Hash functions (used by the gho_T_hash functions, the hash sets and
+ *        the hash maps)
+ */
+
+/**
+ * \brief State of a slot of a hash set or of a hash map
+ * @ingroup gho_hash
+ */
+typedef enum {
+  GHO_HASH_SLOT_EMPTY,
+  GHO_HASH_SLOT_FULL,
+  GHO_HASH_SLOT_DELETED
+} gho_hash_slot_t;
+
+static inline
+size_t gho_hash_ullint(const unsigned long long x);
+static inline
+size_t gho_hash_bytes(const void* const p, const size_t size);
+static inline
+size_t gho_hash_combine(const size_t seed, const size_t h);
+static inline
+size_t gho_hash_capacity(const size_t n);
+
+#include "implementation/hash.h"
+
+#endif
@@ -0,0 +1,60 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#ifndef GHO_HASH_MAP_STRING_SIZE_T_H
+#define GHO_HASH_MAP_STRING_SIZE_T_H
+
+#include "../string.h"
+#include "../int/size_t.h"
+
+
+#define gho_hash_map_T gho_hash_map_string_size_t
+#define gho_hash_map_T_t gho_hash_map_string_size_t_t
+
+#define K_t gho_string_t
+#define V_t size_t
+
+// void gho_K_destroy(K* k);
+#define gho_K_destroy gho_string_destroy
+
+// K gho_K_copy(const K* const k);
+#define gho_K_copy gho_string_copy
+
+// bool gho_K_equal(const K* const a, const K* const b);
+#define gho_K_equal gho_string_equal
+
+// size_t gho_K_hash(const K* const k);
+#define gho_K_hash gho_string_hash
+
+// void gho_V_destroy(V* v);
+#define gho_V_destroy gho_size_t_destroy
+
+// V gho_V_copy(const V* const v);
+#define gho_V_copy gho_size_t_copy
+
+#include "../hash_map_T.h"
+
+
+#ifdef DOXYGEN
+/**
+ * @brief Hash map from gho_string_t to size_t
+ * 
+ * @see gho_hash_map_T_t for documentation
+ */
+struct gho_hash_map_string_size_t_t { };
+#endif
+
+#endif
@@ -0,0 +1,169 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef gho_hash_map_T
+  #error "Please define gho_hash_map_T before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_hash_map_T_t
+  #error "Please define gho_hash_map_T_t before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef K_t
+  #error "Please define K_t before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef V_t
+  #error "Please define V_t before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_K_destroy
+  #error "Please define gho_K_destroy before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_K_copy
+  #error "Please define gho_K_copy before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_K_equal
+  #error "Please define gho_K_equal before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_K_hash
+  #error "Please define gho_K_hash before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_V_destroy
+  #error "Please define gho_V_destroy before include <gho/hash_map_T.h>"
+#endif
+
+#ifndef gho_V_copy
+  #error "Please define gho_V_copy before include <gho/hash_map_T.h>"
+#endif
+
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "memory.h"
+#include "hash.h"
+
+
+// http://stackoverflow.com/questions/13842468/comma-in-c-c-macro
+#define COMMA ,
+
+// http://stackoverflow.com/questions/8587965/c-pre-processor-macro-expansion
+#define concat_name_helper(a, b) a##_##b
+#define concat_name(a_COMMA_b) concat_name_helper(a_COMMA_b)
+
+
+/**
+ * \brief Contains a hash map from K to V (open addressing, linear probing)
+ *
+ * The elements are the (key[i], value[i]) where
+ * state[i] == GHO_HASH_SLOT_FULL, for i in [0, capacity).
+ */
+typedef struct {
+  
+  /// \brief Number of elements
+  size_t size;
+  
+  /// \brief Number of slots (0 or a power of 2)
+  size_t capacity;
+  
+  /// \brief Number of deleted slots
+  size_t nb_deleted;
+  
+  /// \brief State of the slots (gho_hash_slot_t)
+  unsigned char* state;
+  
+  /// \brief Keys of the slots
+  K_t* key;
+  
+  /// \brief Values of the slots
+  V_t* value;
+  
+} gho_hash_map_T_t;
+
+// Create & destroy
+#define gho_hash_map_T_create concat_name(gho_hash_map_T COMMA create)
+#define gho_hash_map_T_destroy concat_name(gho_hash_map_T COMMA destroy)
+#define gho_hash_map_T_reset concat_name(gho_hash_map_T COMMA reset)
+static inline
+gho_hash_map_T_t gho_hash_map_T_create();
+static inline
+void gho_hash_map_T_destroy(gho_hash_map_T_t* map);
+static inline
+void gho_hash_map_T_reset(gho_hash_map_T_t* map);
+
+// Size
+#define gho_hash_map_T_size concat_name(gho_hash_map_T COMMA size)
+#define gho_hash_map_T_empty concat_name(gho_hash_map_T COMMA empty)
+#define gho_hash_map_T_reserve concat_name(gho_hash_map_T COMMA reserve)
+#define gho_hash_map_T_rehash_ concat_name(gho_hash_map_T COMMA rehash_)
+static inline
+size_t gho_hash_map_T_size(const gho_hash_map_T_t* const map);
+static inline
+bool gho_hash_map_T_empty(const gho_hash_map_T_t* const map);
+static inline
+void gho_hash_map_T_reserve(gho_hash_map_T_t* map, const size_t n);
+static inline
+void gho_hash_map_T_rehash_(gho_hash_map_T_t* map, const size_t capacity);
+
+// Get & Set
+#define gho_hash_map_T_get concat_name(gho_hash_map_T COMMA get)
+#define gho_hash_map_T_contains concat_name(gho_hash_map_T COMMA contains)
+#define gho_hash_map_T_set concat_name(gho_hash_map_T COMMA set)
+#define gho_hash_map_T_remove concat_name(gho_hash_map_T COMMA remove)
+#define gho_hash_map_T_find_slot_ concat_name(gho_hash_map_T COMMA find_slot_)
+#define gho_hash_map_T_insert_slot_ \
+  concat_name(gho_hash_map_T COMMA insert_slot_)
+static inline
+V_t* gho_hash_map_T_get(const gho_hash_map_T_t* const map,
+                        const K_t* const key);
+static inline
+bool gho_hash_map_T_contains(const gho_hash_map_T_t* const map,
+                             const K_t* const key);
+static inline
+bool gho_hash_map_T_set(gho_hash_map_T_t* map, const K_t* const key,
+                        const V_t* const value);
+static inline
+bool gho_hash_map_T_remove(gho_hash_map_T_t* map, const K_t* const key);
+static inline
+size_t gho_hash_map_T_find_slot_(const gho_hash_map_T_t* const map,
+                                 const K_t* const key);
+static inline
+size_t gho_hash_map_T_insert_slot_(gho_hash_map_T_t* map,
+                                   const K_t* const key, bool* inserted);
+
+#include "implementation/hash_map_T.h"
+
+
+#undef gho_hash_map_T
+#undef gho_hash_map_T_t
+#undef K_t
+#undef V_t
+
+#undef gho_K_destroy
+#undef gho_K_copy
+#undef gho_K_equal
+#undef gho_K_hash
+#undef gho_V_destroy
+#undef gho_V_copy
+
+#undef concat_name_helper
+#undef concat_name
+#undef COMMA
@@ -0,0 +1,52 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#ifndef GHO_HASH_SET_UINT_H
+#define GHO_HASH_SET_UINT_H
+
+#include "../int/uint.h"
+
+
+#define gho_hash_set_T gho_hash_set_uint
+#define gho_hash_set_T_t gho_hash_set_uint_t
+
+#define T_t gho_uint
+
+// void gho_T_destroy(T* t);
+#define gho_T_destroy gho_uint_destroy
+
+// T gho_T_copy(const T* const t);
+#define gho_T_copy gho_uint_copy
+
+// bool gho_T_equal(const T* const a, const T* const b);
+#define gho_T_equal gho_uint_equal
+
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_uint_hash
+
+#include "../hash_set_T.h"
+
+
+#ifdef DOXYGEN
+/**
+ * @brief Hash set of gho_uint
+ * 
+ * @see gho_hash_set_T_t for documentation
+ */
+struct gho_hash_set_uint_t { };
+#endif
+
+#endif
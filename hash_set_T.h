@@ -0,0 +1,156 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef gho_hash_set_T
+  #error "Please define gho_hash_set_T before include <gho/hash_set_T.h>"
+#endif
+
+#ifndef gho_hash_set_T_t
+  #error "Please define gho_hash_set_T_t before include <gho/hash_set_T.h>"
+#endif
+
+#ifndef T_t
+  #error "Please define T_t before include <gho/hash_set_T.h>"
+#endif
+
+#ifndef gho_T_destroy
+  #error "Please define gho_T_destroy before include <gho/hash_set_T.h>"
+#endif
+
+#ifndef gho_T_copy
+  #error "Please define gho_T_copy before include <gho/hash_set_T.h>"
+#endif
+
+#ifndef gho_T_equal
+  #error "Please define gho_T_equal before include <gho/hash_set_T.h>"
+#endif
+
+#ifndef gho_T_hash
+  #error "Please define gho_T_hash before include <gho/hash_set_T.h>"
+#endif
+
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "memory.h"
+#include "hash.h"
+
+
+// http://stackoverflow.com/questions/13842468/comma-in-c-c-macro
+#define COMMA ,
+
+// http://stackoverflow.com/questions/8587965/c-pre-processor-macro-expansion
+#define concat_name_helper(a, b) a##_##b
+#define concat_name(a_COMMA_b) concat_name_helper(a_COMMA_b)
+
+
+/**
+ * \brief Contains a hash set of T (open addressing, linear probing)
+ *
+ * The elements are the array[i] where state[i] == GHO_HASH_SLOT_FULL,
+ * for i in [0, capacity).
+ */
+typedef struct {
+  
+  /// \brief Number of elements
+  size_t size;
+  
+  /// \brief Number of slots (0 or a power of 2)
+  size_t capacity;
+  
+  /// \brief Number of deleted slots
+  size_t nb_deleted;
+  
+  /// \brief State of the slots (gho_hash_slot_t)
+  unsigned char* state;
+  
+  /// \brief Slots
+  T_t* array;
+  
+} gho_hash_set_T_t;
+
+// Create & destroy
+#define gho_hash_set_T_create concat_name(gho_hash_set_T COMMA create)
+#define gho_hash_set_T_destroy concat_name(gho_hash_set_T COMMA destroy)
+#define gho_hash_set_T_reset concat_name(gho_hash_set_T COMMA reset)
+static inline
+gho_hash_set_T_t gho_hash_set_T_create();
+static inline
+void gho_hash_set_T_destroy(gho_hash_set_T_t* set);
+static inline
+void gho_hash_set_T_reset(gho_hash_set_T_t* set);
+
+// Size
+#define gho_hash_set_T_size concat_name(gho_hash_set_T COMMA size)
+#define gho_hash_set_T_empty concat_name(gho_hash_set_T COMMA empty)
+#define gho_hash_set_T_reserve concat_name(gho_hash_set_T COMMA reserve)
+#define gho_hash_set_T_rehash_ concat_name(gho_hash_set_T COMMA rehash_)
+static inline
+size_t gho_hash_set_T_size(const gho_hash_set_T_t* const set);
+static inline
+bool gho_hash_set_T_empty(const gho_hash_set_T_t* const set);
+static inline
+void gho_hash_set_T_reserve(gho_hash_set_T_t* set, const size_t n);
+static inline
+void gho_hash_set_T_rehash_(gho_hash_set_T_t* set, const size_t capacity);
+
+// Find
+#define gho_hash_set_T_find concat_name(gho_hash_set_T COMMA find)
+#define gho_hash_set_T_contains concat_name(gho_hash_set_T COMMA contains)
+#define gho_hash_set_T_find_slot_ concat_name(gho_hash_set_T COMMA find_slot_)
+static inline
+const T_t* gho_hash_set_T_find(const gho_hash_set_T_t* const set,
+                               const T_t* const t);
+static inline
+bool gho_hash_set_T_contains(const gho_hash_set_T_t* const set,
+                             const T_t* const t);
+static inline
+size_t gho_hash_set_T_find_slot_(const gho_hash_set_T_t* const set,
+                                 const T_t* const t);
+
+// Insert & remove
+#define gho_hash_set_T_insert concat_name(gho_hash_set_T COMMA insert)
+#define gho_hash_set_T_insert_absorb \
+  concat_name(gho_hash_set_T COMMA insert_absorb)
+#define gho_hash_set_T_insert_slot_ \
+  concat_name(gho_hash_set_T COMMA insert_slot_)
+#define gho_hash_set_T_remove concat_name(gho_hash_set_T COMMA remove)
+static inline
+bool gho_hash_set_T_insert(gho_hash_set_T_t* set, const T_t* const t);
+static inline
+bool gho_hash_set_T_insert_absorb(gho_hash_set_T_t* set, T_t* t);
+static inline
+size_t gho_hash_set_T_insert_slot_(gho_hash_set_T_t* set, const T_t* const t,
+                                   bool* inserted);
+static inline
+bool gho_hash_set_T_remove(gho_hash_set_T_t* set, const T_t* const t);
+
+#include "implementation/hash_set_T.h"
+
+
+#undef gho_hash_set_T
+#undef gho_hash_set_T_t
+#undef T_t
+
+#undef gho_T_destroy
+#undef gho_T_copy
+#undef gho_T_equal
+#undef gho_T_hash
+
+#undef concat_name_helper
+#undef concat_name
+#undef COMMA
@@ -0,0 +1,252 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdlib.h>
+#include <string.h>
+
+
+// Arena
+
+/**
+ * \brief Return a new gho_arena_t
+ * \return a new gho_arena_t
+ * @relates gho_arena_t
+ */
+gho_arena_t gho_arena_create() {
+  gho_arena_t arena;
+  arena.allocator = gho_allocator_create(gho_arena_alloc_, gho_arena_realloc_,
+                                         gho_arena_free_);
+  arena.chunk = NULL;
+  arena.chunk_size = gho_arena_chunk_size;
+  return arena;
+}
+
+/**
+ * \brief Destroy a gho_arena_t (all its blocks)
+ * \param[in] arena A gho_arena_t
+ * @relates gho_arena_t
+ */
+void gho_arena_destroy(gho_arena_t* arena) {
+  while (arena->chunk != NULL) {
+    gho_arena_chunk_t* previous = arena->chunk->previous;
+    free(arena->chunk);
+    arena->chunk = previous;
+  }
+}
+
+/**
+ * \brief Reset a gho_arena_t
+ * \param[in] arena A gho_arena_t
+ * @relates gho_arena_t
+ */
+void gho_arena_reset(gho_arena_t* arena) {
+  gho_arena_destroy(arena);
+  *arena = gho_arena_create();
+}
+
+/**
+ * \brief Allocate a block in a gho_arena_t
+ * \param[in] allocator A gho_arena_t
+ * \param[in] size      Size (bytes)
+ * \return the block (NULL if there is no memory)
+ * \warning Do not use this function, it is used by gho_malloc
+ * @relates gho_arena_t
+ */
+void* gho_arena_alloc_(gho_allocator_t* allocator, const size_t size) {
+  gho_arena_t* arena = (gho_arena_t*)allocator;
+  const size_t alignment = sizeof(gho_memory_header_t);
+  const size_t block_size = (size + alignment - 1) / alignment * alignment;
+  if (arena->chunk == NULL ||
+      arena->chunk->size - arena->chunk->used < block_size) {
+    const size_t chunk_size =
+      (block_size > arena->chunk_size) ? block_size : arena->chunk_size;
+    gho_arena_chunk_t* chunk = (gho_arena_chunk_t*)
+      malloc(sizeof(gho_arena_chunk_t) + chunk_size);
+    if (chunk == NULL) { return NULL; }
+    chunk->previous = arena->chunk;
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    arena->chunk = chunk;
+  }
+  char* r = (char*)(arena->chunk + 1) + arena->chunk->used;
+  arena->chunk->used += block_size;
+  return r;
+}
+
+/**
+ * \brief Reallocate a block of a gho_arena_t
+ * \param[in] allocator A gho_arena_t
+ * \param[in] p         A block of the arena
+ * \param[in] old_size  Old size (bytes)
+ * \param[in] size      Size (bytes)
+ * \return the block (NULL if there is no memory)
+ * \warning Do not use this function, it is used by gho_realloc
+ * @relates gho_arena_t
+ */
+void* gho_arena_realloc_(gho_allocator_t* allocator, void* p,
+                         const size_t old_size, const size_t size) {
+  gho_arena_t* arena = (gho_arena_t*)allocator;
+  gho_arena_chunk_t* chunk = arena->chunk;
+  const size_t alignment = sizeof(gho_memory_header_t);
+  const size_t old_block_size =
+    (old_size + alignment - 1) / alignment * alignment;
+  const size_t block_size = (size + alignment - 1) / alignment * alignment;
+  // The last block of the current chunk grows (or shrinks) in place
+  if (chunk != NULL &&
+      (char*)p + old_block_size == (char*)(chunk + 1) + chunk->used &&
+      chunk->used - old_block_size + block_size <= chunk->size) {
+    chunk->used = chunk->used - old_block_size + block_size;
+    return p;
+  }
+  void* r = gho_arena_alloc_(allocator, size);
+  if (r != NULL) { memcpy(r, p, (old_size < size) ? old_size : size); }
+  return r;
+}
+
+/**
+ * \brief Free a block of a gho_arena_t (only the last block is reused)
+ * \param[in] allocator A gho_arena_t
+ * \param[in] p         A block of the arena
+ * \param[in] size      Size (bytes)
+ * \warning Do not use this function, it is used by gho_free
+ * @relates gho_arena_t
+ */
+void gho_arena_free_(gho_allocator_t* allocator, void* p, const size_t size) {
+  gho_arena_t* arena = (gho_arena_t*)allocator;
+  gho_arena_chunk_t* chunk = arena->chunk;
+  const size_t alignment = sizeof(gho_memory_header_t);
+  const size_t block_size = (size + alignment - 1) / alignment * alignment;
+  if (chunk != NULL &&
+      (char*)p + block_size == (char*)(chunk + 1) + chunk->used) {
+    chunk->used -= block_size;
+  }
+}
+
+// Pool
+
+/**
+ * \brief Return a new gho_pool_t
+ * \return a new gho_pool_t
+ * @relates gho_pool_t
+ */
+gho_pool_t gho_pool_create() {
+  gho_pool_t pool;
+  pool.allocator = gho_allocator_create(gho_pool_alloc_, gho_pool_realloc_,
+                                        gho_pool_free_);
+  for (size_t c = 0; c < gho_pool_nb_class_max; ++c) {
+    pool.free_list[c] = NULL;
+  }
+  pool.arena = gho_arena_create();
+  return pool;
+}
+
+/**
+ * \brief Destroy a gho_pool_t (all the blocks of its size classes)
+ * \param[in] pool A gho_pool_t
+ * \warning The blocks bigger than gho_pool_size_max have to be freed before
+ * @relates gho_pool_t
+ */
+void gho_pool_destroy(gho_pool_t* pool) {
+  gho_arena_destroy(&pool->arena);
+  for (size_t c = 0; c < gho_pool_nb_class_max; ++c) {
+    pool->free_list[c] = NULL;
+  }
+}
+
+/**
+ * \brief Reset a gho_pool_t
+ * \param[in] pool A gho_pool_t
+ * @relates gho_pool_t
+ */
+void gho_pool_reset(gho_pool_t* pool) {
+  gho_pool_destroy(pool);
+  *pool = gho_pool_create();
+}
+
+/**
+ * \brief Return the size class of a block
+ * \param[in] size Size (bytes, <= gho_pool_size_max)
+ * \return the size class (the blocks have gho_pool_size_min << class bytes)
+ * \warning Do not use this function, it is used by gho_pool_t
+ * @relates gho_pool_t
+ */
+size_t gho_pool_class_(const size_t size) {
+  size_t c = 0;
+  while ((gho_pool_size_min << c) < size) { ++c; }
+  return c;
+}
+
+/**
+ * \brief Allocate a block in a gho_pool_t
+ * \param[in] allocator A gho_pool_t
+ * \param[in] size      Size (bytes)
+ * \return the block (NULL if there is no memory)
+ * \warning Do not use this function, it is used by gho_malloc
+ * @relates gho_pool_t
+ */
+void* gho_pool_alloc_(gho_allocator_t* allocator, const size_t size) {
+  gho_pool_t* pool = (gho_pool_t*)allocator;
+  if (size > gho_pool_size_max) { return malloc(size); }
+  const size_t c = gho_pool_class_(size);
+  void* r = pool->free_list[c];
+  if (r != NULL) {
+    pool->free_list[c] = *(void**)r;
+    return r;
+  }
+  return gho_arena_alloc_(&pool->arena.allocator, gho_pool_size_min << c);
+}
+
+/**
+ * \brief Reallocate a block of a gho_pool_t
+ * \param[in] allocator A gho_pool_t
+ * \param[in] p         A block of the pool
+ * \param[in] old_size  Old size (bytes)
+ * \param[in] size      Size (bytes)
+ * \return the block (NULL if there is no memory)
+ * \warning Do not use this function, it is used by gho_realloc
+ * @relates gho_pool_t
+ */
+void* gho_pool_realloc_(gho_allocator_t* allocator, void* p,
+                        const size_t old_size, const size_t size) {
+  if (old_size > gho_pool_size_max && size > gho_pool_size_max) {
+    return realloc(p, size);
+  }
+  if (old_size <= gho_pool_size_max && size <= gho_pool_size_max &&
+      gho_pool_class_(old_size) == gho_pool_class_(size)) {
+    return p;
+  }
+  void* r = gho_pool_alloc_(allocator, size);
+  if (r != NULL) {
+    memcpy(r, p, (old_size < size) ? old_size : size);
+    gho_pool_free_(allocator, p, old_size);
+  }
+  return r;
+}
+
+/**
+ * \brief Free a block of a gho_pool_t (it goes in the free list of its class)
+ * \param[in] allocator A gho_pool_t
+ * \param[in] p         A block of the pool
+ * \param[in] size      Size (bytes)
+ * \warning Do not use this function, it is used by gho_free
+ * @relates gho_pool_t
+ */
+void gho_pool_free_(gho_allocator_t* allocator, void* p, const size_t size) {
+  gho_pool_t* pool = (gho_pool_t*)allocator;
+  if (size > gho_pool_size_max) { free(p); return; }
+  const size_t c = gho_pool_class_(size);
+  *(void**)p = pool->free_list[c];
+  pool->free_list[c] = p;
+}
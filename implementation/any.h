@@ -22,15 +22,8 @@
  */
 gho_any_t gho_any_create() {
   gho_any_t any;
-  any.any = NULL;
-  any.type = GHO_TYPE_NULL;
-  any.size_of_struct = 0;
-  any.destroy_fct = NULL;
-  any.fprinti_fct = NULL;
-  any.sprinti_fct = NULL;
-  any.copy_fct = NULL;
-  any.equal_fct = NULL;
-  any.to_string_fct = NULL;
+  any.vtable = NULL;
+  any.any.p = NULL;
   return any;
 }
 
@@ -40,17 +33,11 @@ gho_any_t gho_any_create() {
  * @relates gho_any_t
  */
 void gho_any_destroy(gho_any_t* any) {
-  any->destroy_fct(any->any);
-  free(any->any);
-  any->any = NULL;
-  any->type = GHO_TYPE_NULL;
-  any->size_of_struct = 0;
-  any->destroy_fct = NULL;
-  any->fprinti_fct = NULL;
-  any->sprinti_fct = NULL;
-  any->copy_fct = NULL;
-  any->equal_fct = NULL;
-  any->to_string_fct = NULL;
+  if (any->vtable == NULL) { return; }
+  any->vtable->destroy_fct(gho_any_data(any));
+  if (gho_any_is_inline_(any->vtable) == false) { gho_free(any->any.p); }
+  any->vtable = NULL;
+  any->any.p = NULL;
 }
 
 /**
@@ -63,6 +50,70 @@ void gho_any_reset(gho_any_t* any) {
   *any = gho_any_create();
 }
 
+/**
+ * \brief Return a new gho_any_t with a structure not initialized
+ * \param[in] vtable Type, size and functions of the structure
+ * \return a new gho_any_t, the structure (gho_any_data) has to be initialized
+ * \warning Do not use this function, it is used by the gho_*_to_any functions
+ * @relates gho_any_t
+ */
+gho_any_t gho_any_create_(const gho_any_vtable_t* const vtable) {
+  gho_any_t any;
+  any.vtable = vtable;
+  if (gho_any_is_inline_(vtable) == false) {
+    any.any.p = gho_malloc(vtable->size_of_struct);
+  }
+  return any;
+}
+
+// Structure
+
+/**
+ * \brief Return true if the structures of a type are stored in the gho_any_t
+ * \param[in] vtable Type, size and functions of the structure
+ * \return true if the structure fits in the buffer, false otherwise
+ * \warning Do not use this function, it is used by gho_any_t
+ * @relates gho_any_t
+ */
+bool gho_any_is_inline_(const gho_any_vtable_t* const vtable) {
+  return vtable->size_of_struct <= gho_any_buffer_size;
+}
+
+/**
+ * \brief Return the structure of a gho_any_t
+ * \param[in] any A gho_any_t
+ * \return the structure of the gho_any_t (NULL if it is empty)
+ * @relates gho_any_t
+ */
+void* gho_any_data(gho_any_t* any) {
+  if (any->vtable == NULL) { return NULL; }
+  if (gho_any_is_inline_(any->vtable)) { return any->any.buffer; }
+  return any->any.p;
+}
+
+/**
+ * \brief Return the structure of a gho_any_t
+ * \param[in] any A gho_any_t
+ * \return the structure of the gho_any_t (NULL if it is empty)
+ * @relates gho_any_t
+ */
+const void* gho_any_cdata(const gho_any_t* const any) {
+  if (any->vtable == NULL) { return NULL; }
+  if (gho_any_is_inline_(any->vtable)) { return any->any.buffer; }
+  return any->any.p;
+}
+
+/**
+ * \brief Return the type of the structure of a gho_any_t
+ * \param[in] any A gho_any_t
+ * \return the type of the structure (GHO_TYPE_NULL if it is empty)
+ * @relates gho_any_t
+ */
+gho_type_t gho_any_type(const gho_any_t* const any) {
+  if (any->vtable == NULL) { return GHO_TYPE_NULL; }
+  return any->vtable->type;
+}
+
 // Output
 
 /**
@@ -74,7 +125,7 @@ void gho_any_reset(gho_any_t* any) {
  */
 void gho_any_fprinti(FILE* file, const gho_any_t* const any,
                      const unsigned int indent) {
-  any->fprinti_fct(file, any->any, indent);
+  any->vtable->fprinti_fct(file, gho_any_cdata(any), indent);
 }
 
 /**
@@ -105,7 +156,7 @@ void gho_any_print(const gho_any_t* const any) {
  */
 void gho_any_sprinti(char** c_str, const gho_any_t* const any,
                      const unsigned int indent) {
-  any->sprinti_fct(c_str, any->any, indent);
+  any->vtable->sprinti_fct(c_str, gho_any_cdata(any), indent);
 }
 
 /**
@@ -118,6 +169,24 @@ void gho_any_sprint(char** c_str, const gho_any_t* const any) {
   gho_any_sprinti(c_str, any, 0);
 }
 
+/**
+ * \brief Write a gho_any_t in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] any  A gho_any_t
+ * \warning Only the types which gho_any_fread_bin can read are written (see
+ *          gho_any_fread_bin), the other types are an error
+ * @relates gho_any_t
+ */
+void gho_any_fwrite_bin(FILE* file, const gho_any_t* const any) {
+  if (any->vtable == NULL || any->vtable->fwrite_bin_fct == NULL) {
+    fprintf(stderr, "ERROR: gho_any_fwrite_bin: no binary format for the "
+                    "type %lu!\n", (unsigned long)gho_any_type(any));
+    exit(1);
+  }
+  gho_binary_fwrite_header(file, any->vtable->type, 0);
+  any->vtable->fwrite_bin_fct(file, gho_any_cdata(any));
+}
+
 // Copy & comparisons
 
 /**
@@ -140,16 +209,9 @@ gho_any_t gho_any_copy(const gho_any_t* const any) {
  * @relates gho_any_t
  */
 void gho_any_copy_(const gho_any_t* const any, gho_any_t* copy) {
-  copy->any = malloc(any->size_of_struct);
-  any->copy_fct(any->any, copy->any);
-  copy->type = any->type;
-  copy->size_of_struct = any->size_of_struct;
-  copy->destroy_fct = any->destroy_fct;
-  copy->fprinti_fct = any->fprinti_fct;
-  copy->sprinti_fct = any->sprinti_fct;
-  copy->copy_fct = any->copy_fct;
-  copy->equal_fct = any->equal_fct;
-  copy->to_string_fct = any->to_string_fct;
+  if (any->vtable == NULL) { *copy = gho_any_create(); return; }
+  *copy = gho_any_create_(any->vtable);
+  any->vtable->copy_fct(gho_any_cdata(any), gho_any_data(copy));
 }
 
 /**
@@ -160,11 +222,11 @@ void gho_any_copy_(const gho_any_t* const any, gho_any_t* copy) {
  * @relates gho_any_t
  */
 bool gho_any_equal(const gho_any_t* const a, const gho_any_t* const b) {
-  if (a->equal_fct == NULL || b->equal_fct == NULL) {
+  if (a->vtable == NULL || b->vtable == NULL) {
     return false;
   }
-  else if (a->equal_fct == b->equal_fct) {
-    return a->equal_fct(a->any, b->any);
+  else if (a->vtable->equal_fct == b->vtable->equal_fct) {
+    return a->vtable->equal_fct(gho_any_cdata(a), gho_any_cdata(b));
   }
   else {
     return false;
@@ -180,7 +242,7 @@ bool gho_any_equal(const gho_any_t* const a, const gho_any_t* const b) {
  * @relates gho_any_t
  */
 gho_string_t gho_any_to_string(const gho_any_t* const any) {
-  return any->to_string_fct(any);
+  return any->vtable->to_string_fct(gho_any_cdata(any));
 }
 
 // Conversion for gho_string_t
@@ -192,16 +254,17 @@ gho_string_t gho_any_to_string(const gho_any_t* const any) {
  * @relates gho_any_t
  */
 gho_any_t gho_string_to_any(const gho_string_t* const string) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_GHO_STRING;
-  r.size_of_struct = sizeof(gho_string_t);
-  gho_string_t* p = gho_alloc(gho_string_t); gho_string_copy_(string, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_string_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_string_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_string_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_string_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_string_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_string_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_GHO_STRING, sizeof(gho_string_t),
+    (gho_destroy_fct_t)gho_string_destroy,
+    (gho_fprinti_fct_t)gho_string_fprinti,
+    (gho_sprinti_fct_t)gho_string_sprinti,
+    (gho_copy_fct_t)gho_string_copy_,
+    (gho_equal_fct_t)gho_string_equal,
+    (gho_to_string_fct_t)gho_string_to_string,
+    (gho_fwrite_bin_fct_t)gho_string_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_string_copy_(string, (gho_string_t*)gho_any_data(&r));
   return r;
 }
@@ -0,0 +1,116 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdlib.h>
+
+
+// Input
+
+/**
+ * \brief Read a gho_any_t from a file with the binary format
+ * \param[in] file A C file
+ * \return the gho_any_t read
+ * \warning Only the types of the gho_*_to_any functions of char.h, string.h,
+ *          start_and_size.h and int.h can be read
+ * @relates gho_any_t
+ */
+gho_any_t gho_any_fread_bin(FILE* file) {
+  gho_any_t r;
+  gho_any_fread_bin_(file, &r);
+  return r;
+}
+
+/**
+ * \brief Read a gho_any_t from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] any  A pointer on an not initialized gho_any_t
+ * \warning Do not use this function, use gho_any_fread_bin
+ * @relates gho_any_t
+ */
+void gho_any_fread_bin_(FILE* file, gho_any_t* any) {
+  size_t element_size;
+  const gho_type_t type = gho_binary_fread_header_type(file, &element_size);
+  switch (type) {
+    case GHO_TYPE_CHAR: {
+      const char c = gho_char_fread_bin(file);
+      *any = gho_char_to_any(&c);
+      break;
+    }
+    case GHO_TYPE_INT: {
+      const int i = gho_int_fread_bin(file);
+      *any = gho_int_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_LINT: {
+      const gho_lint i = gho_lint_fread_bin(file);
+      *any = gho_lint_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_LLINT: {
+      const gho_llint i = gho_llint_fread_bin(file);
+      *any = gho_llint_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_SIZE_T: {
+      const size_t i = gho_size_t_fread_bin(file);
+      *any = gho_size_t_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_UINT: {
+      const gho_uint i = gho_uint_fread_bin(file);
+      *any = gho_uint_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_ULINT: {
+      const gho_ulint i = gho_ulint_fread_bin(file);
+      *any = gho_ulint_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_ULLINT: {
+      const gho_ullint i = gho_ullint_fread_bin(file);
+      *any = gho_ullint_to_any(&i);
+      break;
+    }
+    case GHO_TYPE_GHO_START_AND_SIZE: {
+      const gho_start_and_size_t s = gho_start_and_size_fread_bin(file);
+      *any = gho_start_and_size_to_any(&s);
+      break;
+    }
+    case GHO_TYPE_GHO_STRING: {
+      gho_string_t s = gho_string_fread_bin(file);
+      *any = gho_string_to_any(&s);
+      gho_string_destroy(&s);
+      break;
+    }
+    #ifdef gho_with_gmp
+    case GHO_TYPE_GHO_MPZ_T: {
+      gho_mpz_t i = gho_mpz_fread_bin(file);
+      *any = gho_mpz_to_any(&i);
+      gho_mpz_destroy(&i);
+      break;
+    }
+    case GHO_TYPE_GHO_SMPZ_T: {
+      gho_smpz_t i = gho_smpz_fread_bin(file);
+      *any = gho_smpz_to_any(&i);
+      gho_smpz_destroy(&i);
+      break;
+    }
+    #endif
+    default:
+      fprintf(stderr, "ERROR: gho_any_fread_bin: no binary format for the "
+                      "type %lu!\n", (unsigned long)type);
+      exit(1);
+  }
+}
@@ -0,0 +1,189 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdlib.h>
+#include <stdint.h>
+
+
+// Header
+
+/**
+ * \brief Write the header of an object in the binary format
+ * \param[in] file         A C file
+ * \param[in] type         Type of the object
+ * \param[in] element_size Size of an element written as a raw block, 0 if
+ *                         the elements are not written as raw blocks
+ * @ingroup gho_binary
+ */
+void gho_binary_fwrite_header(FILE* file, const gho_type_t type,
+                              const size_t element_size) {
+  const char magic[4] = { 'g', 'h', 'o', '\0' };
+  const uint32_t header[3] = {
+    gho_binary_version, (uint32_t)type, (uint32_t)element_size
+  };
+  gho_binary_fwrite_block(file, magic, 1, 4);
+  gho_binary_fwrite_block(file, header, sizeof(uint32_t), 3);
+}
+
+/**
+ * \brief Read and check the header of an object in the binary format
+ * \param[in] file         A C file
+ * \param[in] type         Expected type of the object
+ * \param[in] element_size Expected size of an element written as a raw block
+ * @ingroup gho_binary
+ */
+void gho_binary_fread_header(FILE* file, const gho_type_t type,
+                             const size_t element_size) {
+  size_t element_size_read;
+  const gho_type_t type_read = gho_binary_fread_header_type(file,
+                                                            &element_size_read);
+  if (type_read != type) {
+    fprintf(stderr, "ERROR: gho_binary_fread_header: wrong type (type read "
+                    "= %lu, type expected = %lu)!\n",
+            (unsigned long)type_read, (unsigned long)type);
+    exit(1);
+  }
+  if (element_size_read != element_size) {
+    fprintf(stderr, "ERROR: gho_binary_fread_header: wrong element size "
+                    "(size read = %lu, size expected = %lu)!\n",
+            (unsigned long)element_size_read, (unsigned long)element_size);
+    exit(1);
+  }
+}
+
+/**
+ * \brief Read the header of an object in the binary format and return the type
+ *        of the object
+ * \param[in]  file         A C file
+ * \param[out] element_size Size of an element written as a raw block
+ * \return the type of the object
+ * @ingroup gho_binary
+ */
+gho_type_t gho_binary_fread_header_type(FILE* file, size_t* element_size) {
+  char magic[4];
+  uint32_t header[3];
+  gho_binary_fread_block(file, magic, 1, 4);
+  if (magic[0] != 'g' || magic[1] != 'h' || magic[2] != 'o' ||
+      magic[3] != '\0') {
+    fprintf(stderr, "ERROR: gho_binary_fread_header: not a gho binary "
+                    "format!\n");
+    exit(1);
+  }
+  gho_binary_fread_block(file, header, sizeof(uint32_t), 3);
+  if (header[0] > gho_binary_version) {
+    fprintf(stderr, "ERROR: gho_binary_fread_header: unknown version of "
+                    "the binary format (%lu)!\n", (unsigned long)header[0]);
+    exit(1);
+  }
+  *element_size = (size_t)header[2];
+  return (gho_type_t)header[1];
+}
+
+// Block
+
+/**
+ * \brief Return true if the system is little-endian, false otherwise
+ * \return true if the system is little-endian, false otherwise
+ * @ingroup gho_binary
+ */
+bool gho_binary_little_endian() {
+  const uint16_t one = 1;
+  return *(const unsigned char*)&one == 1;
+}
+
+/**
+ * \brief Write n elements in little-endian
+ * \param[in] file         A C file
+ * \param[in] data         Array of n elements
+ * \param[in] element_size Size of an element
+ * \param[in] n            Number of elements
+ * @ingroup gho_binary
+ */
+void gho_binary_fwrite_block(FILE* file, const void* const data,
+                             const size_t element_size, const size_t n) {
+  bool ok = true;
+  if (element_size == 1 || gho_binary_little_endian()) {
+    ok = (fwrite(data, element_size, n, file) == n);
+  }
+  else {
+    const unsigned char* const p = (const unsigned char*)data;
+    for (size_t i = 0; i < n && ok; ++i) {
+      for (size_t b = 0; b < element_size && ok; ++b) {
+        ok = (fputc(p[i * element_size + element_size - 1 - b], file) != EOF);
+      }
+    }
+  }
+  if (ok == false) {
+    fprintf(stderr, "ERROR: gho_binary_fwrite_block: can not write!\n");
+    exit(1);
+  }
+}
+
+/**
+ * \brief Read n elements written in little-endian
+ * \param[in] file         A C file
+ * \param[in] data         Array of n elements
+ * \param[in] element_size Size of an element
+ * \param[in] n            Number of elements
+ * @ingroup gho_binary
+ */
+void gho_binary_fread_block(FILE* file, void* data,
+                            const size_t element_size, const size_t n) {
+  if (fread(data, element_size, n, file) != n) {
+    fprintf(stderr, "ERROR: gho_binary_fread_block: unexpected end of "
+                    "file!\n");
+    exit(1);
+  }
+  if (element_size != 1 && gho_binary_little_endian() == false) {
+    unsigned char* const p = (unsigned char*)data;
+    for (size_t i = 0; i < n; ++i) {
+      unsigned char* const e = p + i * element_size;
+      for (size_t b = 0; b < element_size / 2; ++b) {
+        const unsigned char tmp = e[b];
+        e[b] = e[element_size - 1 - b];
+        e[element_size - 1 - b] = tmp;
+      }
+    }
+  }
+}
+
+// Size
+
+/**
+ * \brief Write a size on 8 bytes
+ * \param[in] file A C file
+ * \param[in] size A size
+ * @ingroup gho_binary
+ */
+void gho_binary_fwrite_size(FILE* file, const size_t size) {
+  const uint64_t s = (uint64_t)size;
+  gho_binary_fwrite_block(file, &s, sizeof(uint64_t), 1);
+}
+
+/**
+ * \brief Read a size written on 8 bytes
+ * \param[in] file A C file
+ * \return the size read
+ * @ingroup gho_binary
+ */
+size_t gho_binary_fread_size(FILE* file) {
+  uint64_t s;
+  gho_binary_fread_block(file, &s, sizeof(uint64_t), 1);
+  if (s > (uint64_t)SIZE_MAX) {
+    fprintf(stderr, "ERROR: gho_binary_fread_size: size too large!\n");
+    exit(1);
+  }
+  return (size_t)s;
+}
@@ -20,13 +20,14 @@
 #include "../memory.h"
 #include "../output.h"
 #include "../input.h"
+#include "../string.h"
 
 
 // Create & destroy
 
 /**
  * @brief Return a new C string
- * @return a new C string
+ * @return a new C string (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_create() {
@@ -39,7 +40,7 @@ char* gho_c_str_create() {
 /**
  * @brief Return a new C string from a C string
  * @param[in] c_str A C string
- * @return a new C string
+ * @return a new C string (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_create_from_c_str(const char* const c_str) {
@@ -52,7 +53,7 @@ char* gho_c_str_create_from_c_str(const char* const c_str) {
  * @relates gho_c_str_t
  */
 void gho_c_str_destroy(char** c_str) {
-  free(*c_str); c_str = NULL;
+  gho_free(*c_str); *c_str = NULL;
 }
 
 /**
@@ -122,39 +123,79 @@ void gho_c_str_sprint(char** out, const char* const c_str) {
   gho_c_str_sprinti(out, c_str, 0);
 }
 
+/**
+ * @brief Write a C string in a file with the binary format
+ * @param[in] file  A C file
+ * @param[in] c_str A C string
+ * @relates gho_c_str_t
+ */
+void gho_c_str_fwrite_bin(FILE* file, const char* const c_str) {
+  const size_t size = gho_c_str_size(c_str);
+  gho_binary_fwrite_size(file, size);
+  gho_binary_fwrite_block(file, c_str, 1, size);
+}
+
 // Input
 
 /**
  * @brief Read a C string from a file
  * @param[in] file A C file
- * @return the C string read
+ * @return the C string read (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_fread(FILE* file) {
   gho_read_whitespace(file);
-  char* r = gho_c_str_create();
+  gho_string_t r = gho_string_create();
   while (true) {
     const char c = (char)fgetc(file);
     if (c == EOF) { ungetc(c, file); break; }
     if (isspace(c) != 0) { break; }
-    gho_c_str_add_char(&r, c);
+    gho_string_add_char(&r, c);
   }
-  return r;
+  return r.c_str;
 }
 
 /**
  * @brief Read a C string from a C string
  * @param[in] c_str A C string
- * @return the C string read
+ * @return the C string read (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  char* r = gho_c_str_create();
+  const char* const begin = *c_str;
   while (**c_str != '\0' && isspace(**c_str) == 0) {
-    gho_c_str_add_char(&r, **c_str);
     ++(*c_str);
   }
+  char* r = gho_c_str_create();
+  gho_c_str_add_n(&r, begin, (size_t)(*c_str - begin));
+  return r;
+}
+
+/**
+ * @brief Read a C string from a gho_reader_t
+ * @param[in] reader A gho_reader_t
+ * @return the C string read (free it with gho_c_str_destroy, not with free)
+ * @relates gho_c_str_t
+ */
+char* gho_c_str_rread(gho_reader_t* reader) {
+  const char* word = gho_reader_word(reader);
+  char* r = gho_c_str_sread(&word);
+  gho_reader_set_data(reader, word);
+  return r;
+}
+
+/**
+ * @brief Read a C string from a file with the binary format
+ * @param[in] file A C file
+ * @return the C string read (free it with gho_c_str_destroy, not with free)
+ * @relates gho_c_str_t
+ */
+char* gho_c_str_fread_bin(FILE* file) {
+  const size_t size = gho_binary_fread_size(file);
+  char* r = gho_array_alloc(char, size + 1);
+  gho_binary_fread_block(file, r, 1, size);
+  r[size] = '\0';
   return r;
 }
 
@@ -163,7 +204,7 @@ char* gho_c_str_sread(const char** c_str) {
 /**
  * @brief Copy a C string
  * @param[in] c_str A C string
- * @return the C string copied
+ * @return the C string copied (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_copy(const char* const c_str) {
@@ -197,6 +238,16 @@ int gho_c_str_compare(const char* const a, const char* const b) {
   return c;
 }
 
+/**
+ * \brief Hash a C string
+ * \param[in] c_str A C string
+ * \return the hash of the C string
+ * @relates gho_c_str_t
+ */
+size_t gho_c_str_hash(const char* const c_str) {
+  return gho_hash_bytes(c_str, gho_c_str_size(c_str));
+}
+
 // Size
 
 /**
@@ -228,10 +279,23 @@ bool gho_c_str_empty(const char* const c_str) {
  * @relates gho_c_str_t
  */
 void gho_c_str_add(char** c_str, const char* const to_be_added) {
+  gho_c_str_add_n(c_str, to_be_added, gho_c_str_size(to_be_added));
+}
+
+/**
+ * @brief Add the n first chars of a C string at the end
+ * @param[in] c_str       A C string
+ * @param[in] to_be_added The C string to be added (at least n chars)
+ * @param[in] n           Number of chars to be added
+ * @note To build a long C string piece by piece, use a gho_string_t
+ * @relates gho_c_str_t
+ */
+void gho_c_str_add_n(char** c_str, const char* const to_be_added,
+                     const size_t n) {
   const size_t size_old = gho_c_str_size(*c_str);
-  const size_t size_to_be_added = gho_c_str_size(to_be_added);
-  gho_array_realloc(*c_str, char, size_old + size_to_be_added + 1);
-  strcat(*c_str, to_be_added);
+  gho_array_realloc(*c_str, char, size_old + n + 1);
+  memcpy(*c_str + size_old, to_be_added, n);
+  (*c_str)[size_old + n] = '\0';
 }
 
 /**
@@ -320,20 +384,8 @@ void gho_c_str_remove_last(char** c_str) {
  * @relates gho_c_str_t
  */
 size_t gho_c_str_find(const char* const c_str, const char* const value) {
-  const size_t string_size = gho_c_str_size(c_str);
-  const size_t value_size = gho_c_str_size(value);
-  if (value_size == 0) { return string_size; }
-  if (string_size < value_size) { return string_size; }
-  const size_t i = gho_c_str_find_char(c_str, value[0]);
-  if (i == string_size) { return string_size; }
-  if (i + value_size > string_size) { return string_size; }
-  size_t j;
-  for (j = i + 1 ; j < i + value_size; ++j) {
-    if (c_str[j] != value[j - i]) {
-      return gho_c_str_find(c_str + i + value_size, value);
-    }
-  }
-  return i;
+  return gho_search_find(c_str, gho_c_str_size(c_str),
+                         value, gho_c_str_size(value));
 }
 
 /**
@@ -344,11 +396,64 @@ size_t gho_c_str_find(const char* const c_str, const char* const value) {
  * @relates gho_c_str_t
  */
 size_t gho_c_str_find_char(const char* const c_str, const char value) {
+  const char* const p = strchr(c_str, value);
+  return (p == NULL) ? gho_c_str_size(c_str) : (size_t)(p - c_str);
+}
+
+/**
+ * \brief Find a value in a C string, from an index
+ * \param[in] c_str A C string
+ * \param[in] value The C string to be found
+ * \param[in] i     Index where the search begins
+ * \return the index of the first value found at an index >= i, the size of
+ *         the string if not found or if value is empty
+ * @relates gho_c_str_t
+ */
+size_t gho_c_str_find_from(const char* const c_str, const char* const value,
+                           const size_t i) {
   const size_t size = gho_c_str_size(c_str);
-  for (size_t i = 0; i < size; ++i) {
-    if (c_str[i] == value) { return i; }
-  }
-  return size;
+  if (i >= size) { return size; }
+  return i + gho_search_find(c_str + i, size - i,
+                             value, gho_c_str_size(value));
+}
+
+/**
+ * \brief Find a value in a C string, from the end
+ * \param[in] c_str A C string
+ * \param[in] value The C string to be found
+ * \return the index of the last value found, the size of the string if not
+ *         found or if value is empty
+ * @relates gho_c_str_t
+ */
+size_t gho_c_str_rfind(const char* const c_str, const char* const value) {
+  return gho_search_rfind(c_str, gho_c_str_size(c_str),
+                          value, gho_c_str_size(value));
+}
+
+/**
+ * \brief Find a value in a C string, from the end
+ * \param[in] c_str A C string
+ * \param[in] value The char to be found
+ * \return the index of the last value found, the size of the string if not
+ *         found
+ * @relates gho_c_str_t
+ */
+size_t gho_c_str_rfind_char(const char* const c_str, const char value) {
+  const char* const p = strrchr(c_str, value);
+  return (p == NULL) ? gho_c_str_size(c_str) : (size_t)(p - c_str);
+}
+
+/**
+ * \brief Count the occurrences of a value in a C string
+ * \param[in] c_str A C string
+ * \param[in] value The C string to be counted
+ * \return the number of occurrences (the occurrences which overlap are
+ *         counted), 0 if value is empty
+ * @relates gho_c_str_t
+ */
+size_t gho_c_str_count(const char* const c_str, const char* const value) {
+  return gho_search_count(c_str, gho_c_str_size(c_str),
+                          value, gho_c_str_size(value));
 }
 
 /**
@@ -359,7 +464,8 @@ size_t gho_c_str_find_char(const char* const c_str, const char value) {
  * @relates gho_c_str_t
  */
 bool gho_c_str_contains(const char* const c_str, const char* const value) {
-  return gho_c_str_find(c_str, value) != gho_c_str_size(c_str);
+  const size_t size = gho_c_str_size(c_str);
+  return gho_search_find(c_str, size, value, gho_c_str_size(value)) != size;
 }
 
 // Get line
@@ -368,6 +474,7 @@ bool gho_c_str_contains(const char* const c_str, const char* const value) {
  * @brief Read a line from a file
  * @param[in] file A C file
  * @return the first line in the file
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_get_line(FILE* file) {
@@ -389,6 +496,7 @@ void gho_c_str_ignore_line(FILE* file) {
  * @brief Peek a line from a file
  * @param[in] file A C file
  * @return the first line in the file
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_peek_line(FILE* file) {
@@ -400,17 +508,18 @@ char* gho_c_str_peek_line(FILE* file) {
  * @param[in] file      A C file
  * @param[in] delimiter The delimiter
  * @return the first line in the file until the delimiter is found
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_get_line_delimiter(FILE* file, const char delimiter) {
-  char* r = gho_c_str_create();
+  gho_string_t r = gho_string_create();
   while (true) {
     const char c = (char)fgetc(file);
     if (c == EOF) { ungetc(c, file); break; }
     if (c == delimiter) { break; }
-    gho_c_str_add_char(&r, c);
+    gho_string_add_char(&r, c);
   }
-  return r;
+  return r.c_str;
 }
 
 /**
@@ -430,6 +539,7 @@ void gho_c_str_ignore_line_delimiter(FILE* file, const char delimiter) {
  * @param[in] file      A C file
  * @param[in] delimiter The delimiter
  * @return the first line in the file until the delimiter is found
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_peek_line_delimiter(FILE* file, const char delimiter) {
@@ -446,6 +556,7 @@ char* gho_c_str_peek_line_delimiter(FILE* file, const char delimiter) {
  * @brief Read a line from a C string
  * @param[in] c_str A C string
  * @return the first line in the C string
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_get_line_from_c_str(const char** c_str) {
@@ -467,6 +578,7 @@ void gho_c_str_ignore_line_from_c_str(const char** c_str) {
  * @brief Peek a line from a C string
  * @param[in] c_str A C string
  * @return the first line in the C string
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_peek_line_from_c_str(const char** c_str) {
@@ -478,15 +590,17 @@ char* gho_c_str_peek_line_from_c_str(const char** c_str) {
  * @param[in] c_str     A C string
  * @param[in] delimiter The delimiter
  * @return the first line in the C string until the delimiter is found
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_get_line_from_c_str_delimiter(const char** c_str,
                                               const char delimiter) {
-  char* r = gho_c_str_create();
+  const char* const begin = *c_str;
   while (**c_str != '\0' && **c_str != delimiter) {
-    gho_c_str_add_char(&r, **c_str);
     ++(*c_str);
   }
+  char* r = gho_c_str_create();
+  gho_c_str_add_n(&r, begin, (size_t)(*c_str - begin));
   if (**c_str != '\0') { ++(*c_str); }
   return r;
 }
@@ -509,6 +623,7 @@ void gho_c_str_ignore_line_from_c_str_delimiter(const char** c_str,
  * @param[in] c_str     A C string
  * @param[in] delimiter The delimiter
  * @return the first line in the C string until the delimiter is found
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_c_str_t
  */
 char* gho_c_str_peek_line_from_c_str_delimiter(const char** c_str,
@@ -522,6 +637,83 @@ char* gho_c_str_peek_line_from_c_str_delimiter(const char** c_str,
   return r;
 }
 
+/**
+ * @brief Read a line from a gho_reader_t
+ * @param[in] reader A gho_reader_t
+ * @return the first line in the gho_reader_t
+ *         (free it with gho_c_str_destroy, not with free)
+ * @relates gho_c_str_t
+ */
+char* gho_c_str_get_line_from_reader(gho_reader_t* reader) {
+  return gho_c_str_get_line_from_reader_delimiter(reader, '\n');
+}
+
+/**
+ * @brief Ignore a line from a gho_reader_t
+ * @param[in] reader A gho_reader_t
+ * @relates gho_c_str_t
+ */
+void gho_c_str_ignore_line_from_reader(gho_reader_t* reader) {
+  gho_c_str_ignore_line_from_reader_delimiter(reader, '\n');
+}
+
+/**
+ * @brief Peek a line from a gho_reader_t
+ * @param[in] reader A gho_reader_t
+ * @return the first line in the gho_reader_t
+ *         (free it with gho_c_str_destroy, not with free)
+ * @relates gho_c_str_t
+ */
+char* gho_c_str_peek_line_from_reader(gho_reader_t* reader) {
+  return gho_c_str_peek_line_from_reader_delimiter(reader, '\n');
+}
+
+/**
+ * @brief Read a line from a gho_reader_t until a delimiter
+ * @param[in] reader    A gho_reader_t
+ * @param[in] delimiter The delimiter
+ * @return the first line in the gho_reader_t until the delimiter is found
+ *         (free it with gho_c_str_destroy, not with free)
+ * @relates gho_c_str_t
+ */
+char* gho_c_str_get_line_from_reader_delimiter(gho_reader_t* reader,
+                                               const char delimiter) {
+  char* r = gho_c_str_peek_line_from_reader_delimiter(reader, delimiter);
+  gho_c_str_ignore_line_from_reader_delimiter(reader, delimiter);
+  return r;
+}
+
+/**
+ * @brief Ignore a line from a gho_reader_t until a delimiter
+ * @param[in] reader    A gho_reader_t
+ * @param[in] delimiter The delimiter
+ * @relates gho_c_str_t
+ */
+void gho_c_str_ignore_line_from_reader_delimiter(gho_reader_t* reader,
+                                                 const char delimiter) {
+  const size_t i = gho_reader_find_char(reader, delimiter);
+  if (i != gho_reader_size(reader)) { gho_reader_advance(reader, i + 1); }
+  else { gho_reader_advance(reader, i); }
+}
+
+/**
+ * @brief Peek a line from a gho_reader_t until a delimiter
+ * @param[in] reader    A gho_reader_t
+ * @param[in] delimiter The delimiter
+ * @return the first line in the gho_reader_t until the delimiter is found
+ *         (free it with gho_c_str_destroy, not with free)
+ * @note The line stays in the buffer of the gho_reader_t, nothing is put back
+ *       into the file
+ * @relates gho_c_str_t
+ */
+char* gho_c_str_peek_line_from_reader_delimiter(gho_reader_t* reader,
+                                                const char delimiter) {
+  const size_t i = gho_reader_find_char(reader, delimiter);
+  char* r = gho_c_str_create();
+  gho_c_str_add_n(&r, gho_reader_data(reader), i);
+  return r;
+}
+
 // C++
 
 #if defined(__cplusplus)
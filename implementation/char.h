@@ -107,6 +107,16 @@ void gho_char_sprint(char** c_str, const char* const c) {
   gho_char_sprinti(c_str, c, 0);
 }
 
+/**
+ * \brief Write a char in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] c    A char
+ * @relates gho_char_t
+ */
+void gho_char_fwrite_bin(FILE* file, const char* const c) {
+  gho_binary_fwrite_block(file, c, sizeof(char), 1);
+}
+
 // Input
 
 /**
@@ -133,6 +143,39 @@ char gho_char_sread(const char** c_str) {
   return r;
 }
 
+/**
+ * \brief Read a char from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the char read
+ * @relates gho_char_t
+ */
+char gho_char_rread(gho_reader_t* reader) {
+  return (char)gho_reader_get(reader);
+}
+
+/**
+ * \brief Read a char from a file with the binary format
+ * \param[in] file A C file
+ * \return the char read
+ * @relates gho_char_t
+ */
+char gho_char_fread_bin(FILE* file) {
+  char r;
+  gho_binary_fread_block(file, &r, sizeof(char), 1);
+  return r;
+}
+
+/**
+ * \brief Read a char from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] c    A pointer on an not initialized char
+ * \warning Do not use this function, use gho_char_fread_bin
+ * @relates gho_char_t
+ */
+void gho_char_fread_bin_(FILE* file, char* c) {
+  *c = gho_char_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -180,6 +223,16 @@ int gho_char_compare(const char* const a, const char* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a char
+ * \param[in] c A char
+ * \return the hash of the char
+ * @relates gho_char_t
+ */
+size_t gho_char_hash(const char* const c) {
+  return gho_hash_ullint((unsigned long long)(unsigned char)*c);
+}
+
 // Conversion
 
 /**
@@ -201,17 +254,18 @@ gho_string_t gho_char_to_string(const char* const c) {
  * @relates gho_char_t
  */
 gho_any_t gho_char_to_any(const char* const c) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_INT;
-  r.size_of_struct = sizeof(char);
-  char* p = gho_alloc(char); gho_char_copy_(c, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_char_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_char_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_char_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_char_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_char_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_char_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_CHAR, sizeof(char),
+    (gho_destroy_fct_t)gho_char_destroy,
+    (gho_fprinti_fct_t)gho_char_fprinti,
+    (gho_sprinti_fct_t)gho_char_sprinti,
+    (gho_copy_fct_t)gho_char_copy_,
+    (gho_equal_fct_t)gho_char_equal,
+    (gho_to_string_fct_t)gho_char_to_string,
+    (gho_fwrite_bin_fct_t)gho_char_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_char_copy_(c, (char*)gho_any_data(&r));
   return r;
 }
 
@@ -239,3 +293,13 @@ char gho_char_speek(const char** c_str) {
   char r = **c_str;
   return r;
 }
+
+/**
+ * \brief Peek a char from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the char read
+ * @relates gho_char_t
+ */
+char gho_char_rpeek(gho_reader_t* reader) {
+  return (char)gho_reader_peek(reader);
+}
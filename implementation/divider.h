@@ -0,0 +1,258 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../math.h"
+
+
+// Create
+
+/**
+ * \brief Create a gho_divider_t
+ * \param[in] d The divisor (d != 0)
+ * \return the gho_divider_t of d
+ * @relates gho_divider_t
+ */
+gho_divider_t gho_divider_create(const gho_llint d) {
+  
+  #ifndef NDEBUG
+  if (d == 0) {
+    fprintf(stderr, "ERROR: gho_divider_create(d): d can not be equal to 0!\n");
+    exit(1);
+  }
+  #endif
+  
+  gho_divider_t r;
+  r.d = d;
+  r.d_abs = (d < 0) ? -(gho_ullint)d : (gho_ullint)d;
+  r.ctz = gho_ullint_ctz_(r.d_abs);
+  r.inverse = gho_ullint_inverse_(r.d_abs >> r.ctz);
+  
+  // floor(log2(|d|))
+  const int l = (int)gho_ullint_log2(r.d_abs) - 1;
+  r.shift = l;
+  r.add = false;
+  
+  // |d| is a power of 2: shift only
+  if ((r.d_abs & (r.d_abs - 1)) == 0) {
+    r.magic = 0;
+    return r;
+  }
+  
+  // m = floor(2^(64 + l) / |d|) (fits in 64 bits because 2^l < |d|)
+  gho_ullint m;
+  gho_ullint rem;
+  #ifdef __SIZEOF_INT128__
+    const gho_uint128_t_ num = (gho_uint128_t_)1 << (64 + l);
+    m = (gho_ullint)(num / r.d_abs);
+    rem = (gho_ullint)(num % r.d_abs);
+  #else
+    // Long division of 2^l * 2^64, one bit at a time
+    m = 0;
+    rem = (gho_ullint)1 << l;
+    for (int i = 0; i < 64; ++i) {
+      const bool carry = (rem >> 63) != 0;
+      rem <<= 1;
+      m <<= 1;
+      if (carry || rem >= r.d_abs) { rem -= r.d_abs; m |= 1; }
+    }
+  #endif
+  
+  // m + 1 is exact enough when the error |d| - rem is lower than 2^l,
+  // otherwise the magic number is ceil(2^(65 + l) / |d|), on 65 bits: its
+  // 65th bit is added back in gho_divider_div_abs_
+  if (r.d_abs - rem < ((gho_ullint)1 << l)) {
+    r.magic = m + 1;
+  }
+  else {
+    const gho_ullint twice_rem = rem + rem;
+    m += m;
+    if (twice_rem >= r.d_abs || twice_rem < rem) { m += 1; }
+    r.magic = m + 1;
+    r.add = true;
+  }
+  
+  return r;
+}
+
+// Division
+
+/**
+ * \brief Return floor(n / d)
+ * \param[in] divider A gho_divider_t
+ * \param[in] n       A gho_llint
+ * \return floor(n / d), LLONG_MIN / -1 is LLONG_MIN
+ * @relates gho_divider_t
+ */
+gho_llint gho_divider_floor_div_q(const gho_divider_t* const divider,
+                                  const gho_llint n) {
+  const gho_ullint n_abs = (n < 0) ? -(gho_ullint)n : (gho_ullint)n;
+  return (gho_llint)gho_divider_floor_div_q_(divider, n_abs, n < 0);
+}
+
+/**
+ * \brief Return n - d * floor(n / d)
+ * \param[in] divider A gho_divider_t
+ * \param[in] n       A gho_llint
+ * \return n - d * floor(n / d) (0 or with the sign of d)
+ * @relates gho_divider_t
+ */
+gho_llint gho_divider_floor_div_r(const gho_divider_t* const divider,
+                                  const gho_llint n) {
+  const gho_ullint n_abs = (n < 0) ? -(gho_ullint)n : (gho_ullint)n;
+  return (gho_llint)gho_divider_floor_div_r_(divider, n_abs, n < 0);
+}
+
+/**
+ * \brief Return n / d when d divides n
+ * \param[in] divider A gho_divider_t
+ * \param[in] n       A gho_llint (divisible by d)
+ * \return n / d
+ * \warning The result is wrong if d does not divide n
+ * @relates gho_divider_t
+ */
+gho_llint gho_divider_div_exact(const gho_divider_t* const divider,
+                                const gho_llint n) {
+  const gho_ullint n_abs = (n < 0) ? -(gho_ullint)n : (gho_ullint)n;
+  return (gho_llint)gho_divider_div_exact_(divider, n_abs, n < 0);
+}
+
+/**
+ * \brief Return n modulo d
+ * \param[in] divider A gho_divider_t
+ * \param[in] n       A gho_llint
+ * \return n modulo d, in [0, |d|)
+ * @relates gho_divider_t
+ */
+gho_llint gho_divider_mod(const gho_divider_t* const divider,
+                          const gho_llint n) {
+  const gho_ullint n_abs = (n < 0) ? -(gho_ullint)n : (gho_ullint)n;
+  return (gho_llint)gho_divider_mod_(divider, n_abs, n < 0);
+}
+
+// Division of |n|
+
+/**
+ * \brief Return floor(|n| / |d|)
+ * \param[in] divider A gho_divider_t
+ * \param[in] n_abs   |n|
+ * \return floor(|n| / |d|)
+ * \warning Do not use this function, it is used by the gho_divider_* functions
+ * @relates gho_divider_t
+ */
+gho_ullint gho_divider_div_abs_(const gho_divider_t* const divider,
+                                const gho_ullint n_abs) {
+  // The branches depend on the divider only: they are well predicted
+  if (divider->magic == 0) { return n_abs >> divider->shift; }
+  const gho_ullint q = gho_divider_mul_hi_(divider->magic, n_abs);
+  if (divider->add) { return (((n_abs - q) >> 1) + q) >> divider->shift; }
+  return q >> divider->shift;
+}
+
+/**
+ * \brief Return floor(n / d), n = -|n| if n_neg, |n| otherwise
+ * \param[in] divider A gho_divider_t
+ * \param[in] n_abs   |n|
+ * \param[in] n_neg   true if n < 0
+ * \return floor(n / d) modulo 2^64
+ * \warning Do not use this function, it is used by the gho_divider_* functions
+ * @relates gho_divider_t
+ */
+gho_ullint gho_divider_floor_div_q_(const gho_divider_t* const divider,
+                                    const gho_ullint n_abs, const bool n_neg) {
+  const gho_ullint q = gho_divider_div_abs_(divider, n_abs);
+  // A negative quotient is rounded toward -infinity (without branch)
+  const gho_ullint neg = (gho_ullint)(n_neg != (divider->d < 0));
+  const gho_ullint inexact = (gho_ullint)(q * divider->d_abs != n_abs);
+  return ((q + (neg & inexact)) ^ -neg) + neg;
+}
+
+/**
+ * \brief Return n - d * floor(n / d), n = -|n| if n_neg, |n| otherwise
+ * \param[in] divider A gho_divider_t
+ * \param[in] n_abs   |n|
+ * \param[in] n_neg   true if n < 0
+ * \return n - d * floor(n / d) modulo 2^64
+ * \warning Do not use this function, it is used by the gho_divider_* functions
+ * @relates gho_divider_t
+ */
+gho_ullint gho_divider_floor_div_r_(const gho_divider_t* const divider,
+                                    const gho_ullint n_abs, const bool n_neg) {
+  const gho_ullint q = gho_divider_floor_div_q_(divider, n_abs, n_neg);
+  const gho_ullint n = n_neg ? -n_abs : n_abs;
+  return n - q * (gho_ullint)divider->d;
+}
+
+/**
+ * \brief Return n / d when d divides n, n = -|n| if n_neg, |n| otherwise
+ * \param[in] divider A gho_divider_t
+ * \param[in] n_abs   |n|
+ * \param[in] n_neg   true if n < 0
+ * \return n / d modulo 2^64
+ * \warning Do not use this function, it is used by the gho_divider_* functions
+ * @relates gho_divider_t
+ */
+gho_ullint gho_divider_div_exact_(const gho_divider_t* const divider,
+                                  const gho_ullint n_abs, const bool n_neg) {
+  const gho_ullint q = (n_abs >> divider->ctz) * divider->inverse;
+  const gho_ullint neg = (gho_ullint)(n_neg != (divider->d < 0));
+  return (q ^ -neg) + neg;
+}
+
+/**
+ * \brief Return n modulo d, n = -|n| if n_neg, |n| otherwise
+ * \param[in] divider A gho_divider_t
+ * \param[in] n_abs   |n|
+ * \param[in] n_neg   true if n < 0
+ * \return n modulo d, in [0, |d|)
+ * \warning Do not use this function, it is used by the gho_divider_* functions
+ * @relates gho_divider_t
+ */
+gho_ullint gho_divider_mod_(const gho_divider_t* const divider,
+                            const gho_ullint n_abs, const bool n_neg) {
+  const gho_ullint r =
+    n_abs - gho_divider_div_abs_(divider, n_abs) * divider->d_abs;
+  // |d| - r for a negative n (without branch)
+  const gho_ullint neg = -(gho_ullint)(n_neg && r != 0);
+  return r + (neg & (divider->d_abs - r - r));
+}
+
+/**
+ * \brief Return the 64 high bits of a * b
+ * \param[in] a A gho_ullint
+ * \param[in] b A gho_ullint
+ * \return the 64 high bits of the 128 bits of a * b
+ * \warning Do not use this function, it is used by gho_divider_div_abs_
+ * @relates gho_divider_t
+ */
+gho_ullint gho_divider_mul_hi_(const gho_ullint a, const gho_ullint b) {
+  #ifdef __SIZEOF_INT128__
+    return (gho_ullint)(((gho_uint128_t_)a * b) >> 64);
+  #else
+    const gho_ullint a_lo = a & 0xFFFFFFFFull;
+    const gho_ullint a_hi = a >> 32;
+    const gho_ullint b_lo = b & 0xFFFFFFFFull;
+    const gho_ullint b_hi = b >> 32;
+    const gho_ullint lo_lo = a_lo * b_lo;
+    const gho_ullint hi_lo = a_hi * b_lo;
+    const gho_ullint lo_hi = a_lo * b_hi;
+    const gho_ullint hi_hi = a_hi * b_hi;
+    const gho_ullint cross =
+      (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFull) + lo_hi;
+    return hi_hi + (hi_lo >> 32) + (cross >> 32);
+  #endif
+}
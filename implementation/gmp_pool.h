@@ -0,0 +1,204 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// GMP memory functions
+
+/**
+ * \brief Replace the GMP memory functions by the gho ones
+ * \warning It has to be called before any other GMP function
+ * @ingroup gho_gmp_pool
+ */
+void gho_gmp_memory_functions_install() {
+  mp_set_memory_functions(gho_gmp_alloc_, gho_gmp_realloc_, gho_gmp_free_);
+}
+
+/**
+ * \brief GMP allocation function
+ * \param[in] size Size (bytes)
+ * \return a block tagged GHO_GMP_BLOCK_MALLOC
+ * \warning Do not use this function, it is used by GMP
+ * @ingroup gho_gmp_pool
+ */
+void* gho_gmp_alloc_(size_t size) {
+  gho_gmp_block_header_t* header =
+    (gho_gmp_block_header_t*)malloc(sizeof(gho_gmp_block_header_t) + size);
+  if (header == NULL) {
+    fprintf(stderr, "ERROR: gho_gmp_alloc_: out of memory!\n");
+    exit(1);
+  }
+  header->tag = GHO_GMP_BLOCK_MALLOC;
+  return header + 1;
+}
+
+/**
+ * \brief GMP reallocation function
+ * \param[in] p        A block allocated by gho_gmp_alloc_ or by a pool
+ * \param[in] old_size Old size (bytes)
+ * \param[in] new_size New size (bytes)
+ * \return a block tagged GHO_GMP_BLOCK_MALLOC
+ * \warning Do not use this function, it is used by GMP
+ * @ingroup gho_gmp_pool
+ */
+void* gho_gmp_realloc_(void* p, size_t old_size, size_t new_size) {
+  gho_gmp_block_header_t* header = (gho_gmp_block_header_t*)p - 1;
+  // The block leaves the pool
+  if (header->tag == GHO_GMP_BLOCK_POOL) {
+    void* r = gho_gmp_alloc_(new_size);
+    memcpy(r, p, (old_size < new_size) ? old_size : new_size);
+    return r;
+  }
+  header = (gho_gmp_block_header_t*)
+    realloc(header, sizeof(gho_gmp_block_header_t) + new_size);
+  if (header == NULL) {
+    fprintf(stderr, "ERROR: gho_gmp_realloc_: out of memory!\n");
+    exit(1);
+  }
+  return header + 1;
+}
+
+/**
+ * \brief GMP free function
+ * \param[in] p    A block allocated by gho_gmp_alloc_ or by a pool
+ * \param[in] size Size (bytes)
+ * \warning Do not use this function, it is used by GMP
+ * @ingroup gho_gmp_pool
+ */
+void gho_gmp_free_(void* p, size_t size) {
+  (void)size;
+  gho_gmp_block_header_t* header = (gho_gmp_block_header_t*)p - 1;
+  // The blocks of a pool are released by gho_gmp_pool_destroy
+  if (header->tag == GHO_GMP_BLOCK_MALLOC) {
+    free(header);
+  }
+}
+
+/**
+ * \brief Free a block allocated by GMP (mpz_get_str for example) with the GMP
+ *        free function (it is not always free)
+ * \param[in] p    A block allocated by GMP
+ * \param[in] size Size (bytes)
+ * @ingroup gho_gmp_pool
+ */
+void gho_gmp_free(void* p, size_t size) {
+  void (*gmp_free)(void*, size_t) = NULL;
+  mp_get_memory_functions(NULL, NULL, &gmp_free);
+  gmp_free(p, size);
+}
+
+// Create & destroy
+
+/**
+ * \brief Return a new gho_gmp_pool_t
+ * \return a new gho_gmp_pool_t
+ * @relates gho_gmp_pool_t
+ */
+gho_gmp_pool_t gho_gmp_pool_create() {
+  gho_gmp_pool_t pool;
+  pool.chunk = NULL;
+  pool.chunk_size = gho_gmp_pool_chunk_size;
+  return pool;
+}
+
+/**
+ * \brief Destroy a gho_gmp_pool_t (all its blocks)
+ * \param[in] pool A gho_gmp_pool_t
+ * \warning The mpz_t of the pool have to be destroyed before
+ * @relates gho_gmp_pool_t
+ */
+void gho_gmp_pool_destroy(gho_gmp_pool_t* pool) {
+  while (pool->chunk != NULL) {
+    gho_gmp_pool_chunk_t* previous = pool->chunk->previous;
+    free(pool->chunk);
+    pool->chunk = previous;
+  }
+}
+
+/**
+ * \brief Reset a gho_gmp_pool_t
+ * \param[in] pool A gho_gmp_pool_t
+ * @relates gho_gmp_pool_t
+ */
+void gho_gmp_pool_reset(gho_gmp_pool_t* pool) {
+  gho_gmp_pool_destroy(pool);
+  *pool = gho_gmp_pool_create();
+}
+
+// Allocation
+
+/**
+ * \brief Allocate a block in a gho_gmp_pool_t
+ * \param[in] pool A gho_gmp_pool_t
+ * \param[in] size Size (bytes)
+ * \return a block tagged GHO_GMP_BLOCK_POOL
+ * @relates gho_gmp_pool_t
+ */
+void* gho_gmp_pool_alloc(gho_gmp_pool_t* pool, const size_t size) {
+  const size_t header_size = sizeof(gho_gmp_block_header_t);
+  // Tag + block, rounded to keep the alignment of the next block
+  const size_t block_size =
+    header_size + (size + header_size - 1) / header_size * header_size;
+  if (pool->chunk == NULL ||
+      pool->chunk->size - pool->chunk->used < block_size) {
+    const size_t chunk_size =
+      (block_size > pool->chunk_size) ? block_size : pool->chunk_size;
+    gho_gmp_pool_chunk_t* chunk = (gho_gmp_pool_chunk_t*)
+      malloc(sizeof(gho_gmp_pool_chunk_t) + chunk_size);
+    if (chunk == NULL) {
+      fprintf(stderr, "ERROR: gho_gmp_pool_alloc: out of memory!\n");
+      exit(1);
+    }
+    chunk->previous = pool->chunk;
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    pool->chunk = chunk;
+  }
+  gho_gmp_block_header_t* header = (gho_gmp_block_header_t*)
+    ((char*)(pool->chunk + 1) + pool->chunk->used);
+  pool->chunk->used += block_size;
+  header->tag = GHO_GMP_BLOCK_POOL;
+  return header + 1;
+}
+
+/**
+ * \brief Initialize a mpz_t (0) with limbs of a gho_gmp_pool_t
+ * \param[in] pool    A gho_gmp_pool_t
+ * \param[in] i       A mpz_t not initialized
+ * \param[in] nb_limb Number of limbs reserved in the pool
+ * @relates gho_gmp_pool_t
+ */
+void gho_gmp_pool_mpz_init(gho_gmp_pool_t* pool, mpz_t i,
+                           const size_t nb_limb) {
+  const size_t n = (nb_limb == 0) ? 1 : nb_limb;
+  i->_mp_alloc = (int)n;
+  i->_mp_size = 0;
+  i->_mp_d = (mp_limb_t*)gho_gmp_pool_alloc(pool, n * sizeof(mp_limb_t));
+}
+
+/**
+ * \brief Initialize a mpz_t with limbs of a gho_gmp_pool_t and set it to i
+ * \param[in] pool A gho_gmp_pool_t
+ * \param[in] r    A mpz_t not initialized
+ * \param[in] i    A mpz_t
+ * @relates gho_gmp_pool_t
+ */
+void gho_gmp_pool_mpz_init_set(gho_gmp_pool_t* pool, mpz_t r, const mpz_t i) {
+  gho_gmp_pool_mpz_init(pool, r, mpz_size(i));
+  mpz_set(r, i);
+}
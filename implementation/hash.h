@@ -0,0 +1,70 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * \brief Hash an integer (finalizer of SplitMix64, all the bits of x change
+ *        all the bits of the hash)
+ * \param[in] x An integer
+ * \return the hash of x
+ * @ingroup gho_hash
+ */
+size_t gho_hash_ullint(const unsigned long long x) {
+  unsigned long long h = x;
+  h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+  h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+  h = h ^ (h >> 31);
+  return (size_t)h;
+}
+
+/**
+ * \brief Hash bytes (FNV-1a)
+ * \param[in] p    Bytes
+ * \param[in] size Number of bytes
+ * \return the hash of the bytes
+ * @ingroup gho_hash
+ */
+size_t gho_hash_bytes(const void* const p, const size_t size) {
+  const unsigned char* const bytes = (const unsigned char*)p;
+  unsigned long long h = 0xCBF29CE484222325ull;
+  for (size_t i = 0; i < size; ++i) {
+    h ^= bytes[i];
+    h *= 0x100000001B3ull;
+  }
+  return gho_hash_ullint(h);
+}
+
+/**
+ * \brief Combine two hashes (for a structure with several fields)
+ * \param[in] seed Hash of the first fields
+ * \param[in] h    Hash of the next field
+ * \return the hash of the fields
+ * @ingroup gho_hash
+ */
+size_t gho_hash_combine(const size_t seed, const size_t h) {
+  return gho_hash_ullint((unsigned long long)seed * 31 + h);
+}
+
+/**
+ * \brief Return the number of slots of a hash set or of a hash map for n
+ *        elements (a power of 2, the table is filled at most to 3/4)
+ * \param[in] n Number of elements
+ * \return the number of slots
+ * @ingroup gho_hash
+ */
+size_t gho_hash_capacity(const size_t n) {
+  size_t capacity = 16;
+  while (capacity / 4 * 3 < n) { capacity *= 2; }
+  return capacity;
+}
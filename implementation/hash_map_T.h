@@ -0,0 +1,250 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdlib.h>
+
+#include "../memory.h"
+#include "../hash.h"
+
+
+// Create & destroy
+
+/**
+ * \brief Return a new gho_hash_map_T
+ * \return a new gho_hash_map_T
+ * @relates gho_hash_map_T_t
+ */
+gho_hash_map_T_t gho_hash_map_T_create() {
+  gho_hash_map_T_t map;
+  map.size = 0;
+  map.capacity = 0;
+  map.nb_deleted = 0;
+  map.state = NULL;
+  map.key = NULL;
+  map.value = NULL;
+  return map;
+}
+
+/**
+ * \brief Destroy a gho_hash_map_T
+ * \param[in] map A gho_hash_map_T
+ * @relates gho_hash_map_T_t
+ */
+void gho_hash_map_T_destroy(gho_hash_map_T_t* map) {
+  for (size_t i = 0; i < map->capacity; ++i) {
+    if (map->state[i] == GHO_HASH_SLOT_FULL) {
+      gho_K_destroy(&map->key[i]);
+      gho_V_destroy(&map->value[i]);
+    }
+  }
+  gho_free(map->state);
+  gho_free(map->key);
+  gho_free(map->value);
+}
+
+/**
+ * \brief Reset a gho_hash_map_T
+ * \param[in] map A gho_hash_map_T
+ * @relates gho_hash_map_T_t
+ */
+void gho_hash_map_T_reset(gho_hash_map_T_t* map) {
+  gho_hash_map_T_destroy(map);
+  *map = gho_hash_map_T_create();
+}
+
+// Size
+
+/**
+ * \brief Return the number of elements of a gho_hash_map_T
+ * \param[in] map A gho_hash_map_T
+ * \return the number of elements
+ * @relates gho_hash_map_T_t
+ */
+size_t gho_hash_map_T_size(const gho_hash_map_T_t* const map) {
+  return map->size;
+}
+
+/**
+ * \brief Return true if the gho_hash_map_T is empty
+ * \param[in] map A gho_hash_map_T
+ * \return true if the gho_hash_map_T is empty, false otherwise
+ * @relates gho_hash_map_T_t
+ */
+bool gho_hash_map_T_empty(const gho_hash_map_T_t* const map) {
+  return (map->size == 0);
+}
+
+/**
+ * \brief Update the capacity of a gho_hash_map_T to store n elements without
+ *        rehash
+ * \param[in] map A gho_hash_map_T
+ * \param[in] n   Number of elements
+ * @relates gho_hash_map_T_t
+ */
+void gho_hash_map_T_reserve(gho_hash_map_T_t* map, const size_t n) {
+  const size_t capacity = gho_hash_capacity(n);
+  if (capacity > map->capacity) { gho_hash_map_T_rehash_(map, capacity); }
+}
+
+/**
+ * \brief Move the elements of a gho_hash_map_T in new slots
+ * \param[in] map      A gho_hash_map_T
+ * \param[in] capacity New number of slots (a power of 2 > size)
+ * \warning Do not use this function, it is used when the map grows
+ * @relates gho_hash_map_T_t
+ */
+void gho_hash_map_T_rehash_(gho_hash_map_T_t* map, const size_t capacity) {
+  unsigned char* state = gho_array_alloc(unsigned char, capacity);
+  K_t* key = gho_array_alloc(K_t, capacity);
+  V_t* value = gho_array_alloc(V_t, capacity);
+  for (size_t i = 0; i < capacity; ++i) { state[i] = GHO_HASH_SLOT_EMPTY; }
+  const size_t mask = capacity - 1;
+  for (size_t i = 0; i < map->capacity; ++i) {
+    if (map->state[i] == GHO_HASH_SLOT_FULL) {
+      size_t j = gho_K_hash(&map->key[i]) & mask;
+      while (state[j] != GHO_HASH_SLOT_EMPTY) { j = (j + 1) & mask; }
+      state[j] = GHO_HASH_SLOT_FULL;
+      key[j] = map->key[i];
+      value[j] = map->value[i];
+    }
+  }
+  gho_free(map->state);
+  gho_free(map->key);
+  gho_free(map->value);
+  map->state = state;
+  map->key = key;
+  map->value = value;
+  map->capacity = capacity;
+  map->nb_deleted = 0;
+}
+
+// Get & Set
+
+/**
+ * \brief Return the value of a key
+ * \param[in] map A gho_hash_map_T
+ * \param[in] key A K
+ * \return the value of the key, NULL if the key is not in the map
+ * @relates gho_hash_map_T_t
+ */
+V_t* gho_hash_map_T_get(const gho_hash_map_T_t* const map,
+                        const K_t* const key) {
+  const size_t i = gho_hash_map_T_find_slot_(map, key);
+  if (i == map->capacity) { return NULL; }
+  return &map->value[i];
+}
+
+/**
+ * \brief Return true if a gho_hash_map_T contains a key
+ * \param[in] map A gho_hash_map_T
+ * \param[in] key A K
+ * \return true if the key is in the map, false otherwise
+ * @relates gho_hash_map_T_t
+ */
+bool gho_hash_map_T_contains(const gho_hash_map_T_t* const map,
+                             const K_t* const key) {
+  return gho_hash_map_T_find_slot_(map, key) != map->capacity;
+}
+
+/**
+ * \brief Set the value of a key (the previous value is destroyed)
+ * \param[in] map   A gho_hash_map_T
+ * \param[in] key   A K
+ * \param[in] value The V to be setted
+ * \return true if the key was inserted, false if the map contained it
+ * @relates gho_hash_map_T_t
+ */
+bool gho_hash_map_T_set(gho_hash_map_T_t* map, const K_t* const key,
+                        const V_t* const value) {
+  bool inserted;
+  const size_t i = gho_hash_map_T_insert_slot_(map, key, &inserted);
+  if (inserted) { map->key[i] = gho_K_copy(key); }
+  else { gho_V_destroy(&map->value[i]); }
+  map->value[i] = gho_V_copy(value);
+  return inserted;
+}
+
+/**
+ * \brief Remove a key (and its value) of a gho_hash_map_T
+ * \param[in] map A gho_hash_map_T
+ * \param[in] key The K to be removed
+ * \return true if the key was removed, false otherwise
+ * @relates gho_hash_map_T_t
+ */
+bool gho_hash_map_T_remove(gho_hash_map_T_t* map, const K_t* const key) {
+  const size_t i = gho_hash_map_T_find_slot_(map, key);
+  if (i == map->capacity) { return false; }
+  gho_K_destroy(&map->key[i]);
+  gho_V_destroy(&map->value[i]);
+  map->state[i] = GHO_HASH_SLOT_DELETED;
+  --map->size;
+  ++map->nb_deleted;
+  return true;
+}
+
+/**
+ * \brief Return the slot of a key
+ * \param[in] map A gho_hash_map_T
+ * \param[in] key The K to be found
+ * \return the slot of the key, the capacity if it is not in the map
+ * \warning Do not use this function, use gho_hash_map_T_get
+ * @relates gho_hash_map_T_t
+ */
+size_t gho_hash_map_T_find_slot_(const gho_hash_map_T_t* const map,
+                                 const K_t* const key) {
+  if (map->size == 0) { return map->capacity; }
+  const size_t mask = map->capacity - 1;
+  size_t i = gho_K_hash(key) & mask;
+  while (map->state[i] != GHO_HASH_SLOT_EMPTY) {
+    if (map->state[i] == GHO_HASH_SLOT_FULL &&
+        gho_K_equal(&map->key[i], key)) {
+      return i;
+    }
+    i = (i + 1) & mask;
+  }
+  return map->capacity;
+}
+
+/**
+ * \brief Return the slot of a key, a new slot if it is not in the map
+ * \param[in]  map      A gho_hash_map_T
+ * \param[in]  key      A K
+ * \param[out] inserted true if the slot is new (key and value not
+ *                      initialized), false if it contains the key
+ * \return the slot
+ * \warning Do not use this function, use gho_hash_map_T_set
+ * @relates gho_hash_map_T_t
+ */
+size_t gho_hash_map_T_insert_slot_(gho_hash_map_T_t* map,
+                                   const K_t* const key, bool* inserted) {
+  if ((map->size + map->nb_deleted + 1) > map->capacity / 4 * 3) {
+    gho_hash_map_T_rehash_(map, gho_hash_capacity(map->size + 1));
+  }
+  const size_t mask = map->capacity - 1;
+  size_t i = gho_K_hash(key) & mask;
+  size_t deleted = map->capacity;
+  while (map->state[i] != GHO_HASH_SLOT_EMPTY) {
+    if (map->state[i] == GHO_HASH_SLOT_FULL) {
+      if (gho_K_equal(&map->key[i], key)) { *inserted = false; return i; }
+    }
+    else if (deleted == map->capacity) { deleted = i; }
+    i = (i + 1) & mask;
+  }
+  if (deleted != map->capacity) { i = deleted; --map->nb_deleted; }
+  map->state[i] = GHO_HASH_SLOT_FULL;
+  ++map->size;
+  *inserted = true;
+  return i;
+}
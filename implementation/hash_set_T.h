@@ -0,0 +1,257 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdlib.h>
+
+#include "../memory.h"
+#include "../hash.h"
+
+
+// Create & destroy
+
+/**
+ * \brief Return a new gho_hash_set_T
+ * \return a new gho_hash_set_T
+ * @relates gho_hash_set_T_t
+ */
+gho_hash_set_T_t gho_hash_set_T_create() {
+  gho_hash_set_T_t set;
+  set.size = 0;
+  set.capacity = 0;
+  set.nb_deleted = 0;
+  set.state = NULL;
+  set.array = NULL;
+  return set;
+}
+
+/**
+ * \brief Destroy a gho_hash_set_T
+ * \param[in] set A gho_hash_set_T
+ * @relates gho_hash_set_T_t
+ */
+void gho_hash_set_T_destroy(gho_hash_set_T_t* set) {
+  for (size_t i = 0; i < set->capacity; ++i) {
+    if (set->state[i] == GHO_HASH_SLOT_FULL) {
+      gho_T_destroy(&set->array[i]);
+    }
+  }
+  gho_free(set->state);
+  gho_free(set->array);
+}
+
+/**
+ * \brief Reset a gho_hash_set_T
+ * \param[in] set A gho_hash_set_T
+ * @relates gho_hash_set_T_t
+ */
+void gho_hash_set_T_reset(gho_hash_set_T_t* set) {
+  gho_hash_set_T_destroy(set);
+  *set = gho_hash_set_T_create();
+}
+
+// Size
+
+/**
+ * \brief Return the number of elements of a gho_hash_set_T
+ * \param[in] set A gho_hash_set_T
+ * \return the number of elements
+ * @relates gho_hash_set_T_t
+ */
+size_t gho_hash_set_T_size(const gho_hash_set_T_t* const set) {
+  return set->size;
+}
+
+/**
+ * \brief Return true if the gho_hash_set_T is empty
+ * \param[in] set A gho_hash_set_T
+ * \return true if the gho_hash_set_T is empty, false otherwise
+ * @relates gho_hash_set_T_t
+ */
+bool gho_hash_set_T_empty(const gho_hash_set_T_t* const set) {
+  return (set->size == 0);
+}
+
+/**
+ * \brief Update the capacity of a gho_hash_set_T to store n elements without
+ *        rehash
+ * \param[in] set A gho_hash_set_T
+ * \param[in] n   Number of elements
+ * @relates gho_hash_set_T_t
+ */
+void gho_hash_set_T_reserve(gho_hash_set_T_t* set, const size_t n) {
+  const size_t capacity = gho_hash_capacity(n);
+  if (capacity > set->capacity) { gho_hash_set_T_rehash_(set, capacity); }
+}
+
+/**
+ * \brief Move the elements of a gho_hash_set_T in new slots
+ * \param[in] set      A gho_hash_set_T
+ * \param[in] capacity New number of slots (a power of 2 > size)
+ * \warning Do not use this function, it is used when the set grows
+ * @relates gho_hash_set_T_t
+ */
+void gho_hash_set_T_rehash_(gho_hash_set_T_t* set, const size_t capacity) {
+  unsigned char* state = gho_array_alloc(unsigned char, capacity);
+  T_t* array = gho_array_alloc(T_t, capacity);
+  for (size_t i = 0; i < capacity; ++i) { state[i] = GHO_HASH_SLOT_EMPTY; }
+  const size_t mask = capacity - 1;
+  for (size_t i = 0; i < set->capacity; ++i) {
+    if (set->state[i] == GHO_HASH_SLOT_FULL) {
+      size_t j = gho_T_hash(&set->array[i]) & mask;
+      while (state[j] != GHO_HASH_SLOT_EMPTY) { j = (j + 1) & mask; }
+      state[j] = GHO_HASH_SLOT_FULL;
+      array[j] = set->array[i];
+    }
+  }
+  gho_free(set->state);
+  gho_free(set->array);
+  set->state = state;
+  set->array = array;
+  set->capacity = capacity;
+  set->nb_deleted = 0;
+}
+
+// Find
+
+/**
+ * \brief Find an element in a gho_hash_set_T
+ * \param[in] set A gho_hash_set_T
+ * \param[in] t   The T to be found
+ * \return the element equal to t, NULL if there is not
+ * @relates gho_hash_set_T_t
+ */
+const T_t* gho_hash_set_T_find(const gho_hash_set_T_t* const set,
+                               const T_t* const t) {
+  const size_t i = gho_hash_set_T_find_slot_(set, t);
+  if (i == set->capacity) { return NULL; }
+  return &set->array[i];
+}
+
+/**
+ * \brief Return true if a gho_hash_set_T contains an element
+ * \param[in] set A gho_hash_set_T
+ * \param[in] t   A T
+ * \return true if an element is equal to t, false otherwise
+ * @relates gho_hash_set_T_t
+ */
+bool gho_hash_set_T_contains(const gho_hash_set_T_t* const set,
+                             const T_t* const t) {
+  return gho_hash_set_T_find_slot_(set, t) != set->capacity;
+}
+
+/**
+ * \brief Return the slot of an element
+ * \param[in] set A gho_hash_set_T
+ * \param[in] t   The T to be found
+ * \return the slot of the element equal to t, the capacity if there is not
+ * \warning Do not use this function, use gho_hash_set_T_find
+ * @relates gho_hash_set_T_t
+ */
+size_t gho_hash_set_T_find_slot_(const gho_hash_set_T_t* const set,
+                                 const T_t* const t) {
+  if (set->size == 0) { return set->capacity; }
+  const size_t mask = set->capacity - 1;
+  size_t i = gho_T_hash(t) & mask;
+  while (set->state[i] != GHO_HASH_SLOT_EMPTY) {
+    if (set->state[i] == GHO_HASH_SLOT_FULL &&
+        gho_T_equal(&set->array[i], t)) {
+      return i;
+    }
+    i = (i + 1) & mask;
+  }
+  return set->capacity;
+}
+
+// Insert & remove
+
+/**
+ * \brief Insert a T if the gho_hash_set_T does not contain it
+ * \param[in] set A gho_hash_set_T
+ * \param[in] t   The T to be inserted
+ * \return true if t was inserted, false if the set contained it
+ * @relates gho_hash_set_T_t
+ */
+bool gho_hash_set_T_insert(gho_hash_set_T_t* set, const T_t* const t) {
+  bool inserted;
+  const size_t i = gho_hash_set_T_insert_slot_(set, t, &inserted);
+  if (inserted) { set->array[i] = gho_T_copy(t); }
+  return inserted;
+}
+
+/**
+ * \brief Move and insert a T if the gho_hash_set_T does not contain it
+ * \param[in] set A gho_hash_set_T
+ * \param[in] t   The T to be moved and inserted
+ * \return true if t was inserted, false if the set contained it (then t is
+ *         destroyed)
+ * \warning The t variable is moved, do not use it after this function
+ * @relates gho_hash_set_T_t
+ */
+bool gho_hash_set_T_insert_absorb(gho_hash_set_T_t* set, T_t* t) {
+  bool inserted;
+  const size_t i = gho_hash_set_T_insert_slot_(set, t, &inserted);
+  if (inserted) { set->array[i] = *t; }
+  else { gho_T_destroy(t); }
+  return inserted;
+}
+
+/**
+ * \brief Return the slot of an element, a new slot if it is not in the set
+ * \param[in]  set      A gho_hash_set_T
+ * \param[in]  t        A T
+ * \param[out] inserted true if the slot is new (not initialized), false if
+ *                      it contains an element equal to t
+ * \return the slot
+ * \warning Do not use this function, use gho_hash_set_T_insert
+ * @relates gho_hash_set_T_t
+ */
+size_t gho_hash_set_T_insert_slot_(gho_hash_set_T_t* set, const T_t* const t,
+                                   bool* inserted) {
+  if ((set->size + set->nb_deleted + 1) > set->capacity / 4 * 3) {
+    gho_hash_set_T_rehash_(set, gho_hash_capacity(set->size + 1));
+  }
+  const size_t mask = set->capacity - 1;
+  size_t i = gho_T_hash(t) & mask;
+  size_t deleted = set->capacity;
+  while (set->state[i] != GHO_HASH_SLOT_EMPTY) {
+    if (set->state[i] == GHO_HASH_SLOT_FULL) {
+      if (gho_T_equal(&set->array[i], t)) { *inserted = false; return i; }
+    }
+    else if (deleted == set->capacity) { deleted = i; }
+    i = (i + 1) & mask;
+  }
+  if (deleted != set->capacity) { i = deleted; --set->nb_deleted; }
+  set->state[i] = GHO_HASH_SLOT_FULL;
+  ++set->size;
+  *inserted = true;
+  return i;
+}
+
+/**
+ * \brief Remove an element of a gho_hash_set_T
+ * \param[in] set A gho_hash_set_T
+ * \param[in] t   The T to be removed
+ * \return true if an element was removed, false otherwise
+ * @relates gho_hash_set_T_t
+ */
+bool gho_hash_set_T_remove(gho_hash_set_T_t* set, const T_t* const t) {
+  const size_t i = gho_hash_set_T_find_slot_(set, t);
+  if (i == set->capacity) { return false; }
+  gho_T_destroy(&set->array[i]);
+  set->state[i] = GHO_HASH_SLOT_DELETED;
+  --set->size;
+  ++set->nb_deleted;
+  return true;
+}
@@ -110,6 +110,16 @@ void gho_int_sprint(char** c_str, const int* const i) {
   gho_int_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a int in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A int
+ * @relates gho_int
+ */
+void gho_int_fwrite_bin(FILE* file, const int* const i) {
+  gho_binary_fwrite_block(file, i, sizeof(int), 1);
+}
+
 // Input
 
 /**
@@ -133,17 +143,48 @@ int gho_int_fread(FILE* file) {
  */
 int gho_int_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  int r = atoi(*c_str);
-  if (**c_str != '\0' && *(*c_str + 1) != '\0' &&
-      **c_str == '-' && isdigit(*(*c_str + 1))) {
-    ++(*c_str);
-  }
-  while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    ++(*c_str);
-  }
+  char* end = NULL;
+  int r = (int)strtol(*c_str, &end, 10);
+  *c_str = end;
+  return r;
+}
+
+/**
+ * \brief Read a int from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the int read
+ * @relates gho_int
+ */
+int gho_int_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  int r = gho_int_sread(&token);
+  gho_reader_set_data(reader, token);
   return r;
 }
 
+/**
+ * \brief Read a int from a file with the binary format
+ * \param[in] file A C file
+ * \return the int read
+ * @relates gho_int
+ */
+int gho_int_fread_bin(FILE* file) {
+  int r;
+  gho_binary_fread_block(file, &r, sizeof(int), 1);
+  return r;
+}
+
+/**
+ * \brief Read a int from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized int
+ * \warning Do not use this function, use gho_int_fread_bin
+ * @relates gho_int
+ */
+void gho_int_fread_bin_(FILE* file, int* i) {
+  *i = gho_int_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -191,6 +232,16 @@ int gho_int_compare(const int* const a, const int* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a int
+ * \param[in] i A int
+ * \return the hash of the int
+ * @relates gho_int
+ */
+size_t gho_int_hash(const int* const i) {
+  return gho_hash_ullint((unsigned long long)*i);
+}
+
 // Conversion
 
 /**
@@ -214,16 +265,17 @@ gho_string_t gho_int_to_string(const int* const i) {
  * @relates gho_int
  */
 gho_any_t gho_int_to_any(const int* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_INT;
-  r.size_of_struct = sizeof(int);
-  int* p = gho_alloc(int); gho_int_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_int_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_int_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_int_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_int_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_int_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_int_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_INT, sizeof(int),
+    (gho_destroy_fct_t)gho_int_destroy,
+    (gho_fprinti_fct_t)gho_int_fprinti,
+    (gho_sprinti_fct_t)gho_int_sprinti,
+    (gho_copy_fct_t)gho_int_copy_,
+    (gho_equal_fct_t)gho_int_equal,
+    (gho_to_string_fct_t)gho_int_to_string,
+    (gho_fwrite_bin_fct_t)gho_int_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_int_copy_(i, (int*)gho_any_data(&r));
   return r;
 }
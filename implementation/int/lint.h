@@ -110,6 +110,16 @@ void gho_lint_sprint(char** c_str, const gho_lint* const i) {
   gho_lint_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a long int in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A long int
+ * @relates gho_lint
+ */
+void gho_lint_fwrite_bin(FILE* file, const gho_lint* const i) {
+  gho_binary_fwrite_block(file, i, sizeof(gho_lint), 1);
+}
+
 // Input
 
 /**
@@ -133,17 +143,48 @@ gho_lint gho_lint_fread(FILE* file) {
  */
 gho_lint gho_lint_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  gho_lint r = (gho_lint)atoi(*c_str);
-  if (**c_str != '\0' && *(*c_str + 1) != '\0' &&
-      **c_str == '-' && isdigit(*(*c_str + 1))) {
-    ++(*c_str);
-  }
-  while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    ++(*c_str);
-  }
+  char* end = NULL;
+  gho_lint r = (gho_lint)strtol(*c_str, &end, 10);
+  *c_str = end;
+  return r;
+}
+
+/**
+ * \brief Read a long int from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the long int read
+ * @relates gho_lint
+ */
+gho_lint gho_lint_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  gho_lint r = gho_lint_sread(&token);
+  gho_reader_set_data(reader, token);
   return r;
 }
 
+/**
+ * \brief Read a long int from a file with the binary format
+ * \param[in] file A C file
+ * \return the long int read
+ * @relates gho_lint
+ */
+gho_lint gho_lint_fread_bin(FILE* file) {
+  gho_lint r;
+  gho_binary_fread_block(file, &r, sizeof(gho_lint), 1);
+  return r;
+}
+
+/**
+ * \brief Read a long int from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized gho_lint
+ * \warning Do not use this function, use gho_lint_fread_bin
+ * @relates gho_lint
+ */
+void gho_lint_fread_bin_(FILE* file, gho_lint* i) {
+  *i = gho_lint_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -191,6 +232,16 @@ int gho_lint_compare(const gho_lint* const a, const gho_lint* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a long int
+ * \param[in] i A long int
+ * \return the hash of the long int
+ * @relates gho_lint
+ */
+size_t gho_lint_hash(const gho_lint* const i) {
+  return gho_hash_ullint((unsigned long long)*i);
+}
+
 // Conversion
 
 /**
@@ -214,16 +265,17 @@ gho_string_t gho_lint_to_string(const gho_lint* const i) {
  * @relates gho_lint
  */
 gho_any_t gho_lint_to_any(const gho_lint* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_LINT;
-  r.size_of_struct = sizeof(gho_lint);
-  gho_lint* p = gho_alloc(gho_lint); gho_lint_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_lint_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_lint_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_lint_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_lint_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_lint_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_lint_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_LINT, sizeof(gho_lint),
+    (gho_destroy_fct_t)gho_lint_destroy,
+    (gho_fprinti_fct_t)gho_lint_fprinti,
+    (gho_sprinti_fct_t)gho_lint_sprinti,
+    (gho_copy_fct_t)gho_lint_copy_,
+    (gho_equal_fct_t)gho_lint_equal,
+    (gho_to_string_fct_t)gho_lint_to_string,
+    (gho_fwrite_bin_fct_t)gho_lint_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_lint_copy_(i, (gho_lint*)gho_any_data(&r));
   return r;
 }
@@ -110,6 +110,16 @@ void gho_llint_sprint(char** c_str, const gho_llint* const i) {
   gho_llint_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a long long int in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A long long int
+ * @relates gho_llint
+ */
+void gho_llint_fwrite_bin(FILE* file, const gho_llint* const i) {
+  gho_binary_fwrite_block(file, i, sizeof(gho_llint), 1);
+}
+
 // Input
 
 /**
@@ -133,17 +143,48 @@ gho_llint gho_llint_fread(FILE* file) {
  */
 gho_llint gho_llint_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  gho_llint r = (gho_llint)atoi(*c_str);
-  if (**c_str != '\0' && *(*c_str + 1) != '\0' &&
-      **c_str == '-' && isdigit(*(*c_str + 1))) {
-    ++(*c_str);
-  }
-  while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    ++(*c_str);
-  }
+  char* end = NULL;
+  gho_llint r = (gho_llint)strtoll(*c_str, &end, 10);
+  *c_str = end;
+  return r;
+}
+
+/**
+ * \brief Read a long long int from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the long long int read
+ * @relates gho_llint
+ */
+gho_llint gho_llint_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  gho_llint r = gho_llint_sread(&token);
+  gho_reader_set_data(reader, token);
   return r;
 }
 
+/**
+ * \brief Read a long long int from a file with the binary format
+ * \param[in] file A C file
+ * \return the long long int read
+ * @relates gho_llint
+ */
+gho_llint gho_llint_fread_bin(FILE* file) {
+  gho_llint r;
+  gho_binary_fread_block(file, &r, sizeof(gho_llint), 1);
+  return r;
+}
+
+/**
+ * \brief Read a long long int from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized gho_llint
+ * \warning Do not use this function, use gho_llint_fread_bin
+ * @relates gho_llint
+ */
+void gho_llint_fread_bin_(FILE* file, gho_llint* i) {
+  *i = gho_llint_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -191,6 +232,16 @@ int gho_llint_compare(const gho_llint* const a, const gho_llint* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a long long int
+ * \param[in] i A long long int
+ * \return the hash of the long long int
+ * @relates gho_llint
+ */
+size_t gho_llint_hash(const gho_llint* const i) {
+  return gho_hash_ullint((unsigned long long)*i);
+}
+
 // Conversion
 
 /**
@@ -214,16 +265,17 @@ gho_string_t gho_llint_to_string(const gho_llint* const i) {
  * @relates gho_llint
  */
 gho_any_t gho_llint_to_any(const gho_llint* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_LLINT;
-  r.size_of_struct = sizeof(gho_llint);
-  gho_llint* p = gho_alloc(gho_llint); gho_llint_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_llint_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_llint_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_llint_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_llint_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_llint_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_llint_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_LLINT, sizeof(gho_llint),
+    (gho_destroy_fct_t)gho_llint_destroy,
+    (gho_fprinti_fct_t)gho_llint_fprinti,
+    (gho_sprinti_fct_t)gho_llint_sprinti,
+    (gho_copy_fct_t)gho_llint_copy_,
+    (gho_equal_fct_t)gho_llint_equal,
+    (gho_to_string_fct_t)gho_llint_to_string,
+    (gho_fwrite_bin_fct_t)gho_llint_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_llint_copy_(i, (gho_llint*)gho_any_data(&r));
   return r;
 }
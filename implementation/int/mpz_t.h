@@ -16,6 +16,7 @@
 #include <limits.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "../../output.h"
 #include "../../input.h"
@@ -47,6 +48,20 @@ gho_mpz_t gho_mpz_create_from_gmp(const mpz_t* const gmp_mpz) {
   return i;
 }
 
+/**
+ * \brief Return a new gho_mpz_t (0) with limbs of a gho_gmp_pool_t
+ * \param[in] pool    A gho_gmp_pool_t
+ * \param[in] nb_limb Number of limbs reserved in the pool
+ * \return a new gho_mpz_t with limbs of a gho_gmp_pool_t
+ * \warning gho_gmp_memory_functions_install has to be called before
+ * @relates gho_mpz_t
+ */
+gho_mpz_t gho_mpz_create_in_pool(gho_gmp_pool_t* pool, const size_t nb_limb) {
+  gho_mpz_t i;
+  gho_gmp_pool_mpz_init(pool, i.i, nb_limb);
+  return i;
+}
+
 /**
  * \brief Destroy a gho_mpz_t
  * \param[in] i A gho_mpz_t
@@ -113,7 +128,7 @@ void gho_mpz_sprinti(char** c_str, const gho_mpz_t* const i,
   char* tmp = NULL;
   tmp = mpz_get_str(tmp, 10, i->i);
   gho_c_str_add(c_str, tmp);
-  free(tmp); tmp = NULL;
+  gho_gmp_free(tmp, strlen(tmp) + 1); tmp = NULL;
 }
 
 /**
@@ -126,6 +141,24 @@ void gho_mpz_sprint(char** c_str, const gho_mpz_t* const i) {
   gho_mpz_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a gho_mpz_t in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A gho_mpz_t
+ * @relates gho_mpz_t
+ */
+void gho_mpz_fwrite_bin(FILE* file, const gho_mpz_t* const i) {
+  const unsigned char negative = (mpz_sgn(i->i) < 0) ? 1 : 0;
+  size_t size = (mpz_sizeinbase(i->i, 2) + 7) / 8;
+  unsigned char* bytes = gho_array_alloc(unsigned char, size + 1);
+  if (mpz_sgn(i->i) == 0) { size = 0; }
+  else { mpz_export(bytes, &size, -1, 1, 0, 0, i->i); }
+  gho_binary_fwrite_block(file, &negative, 1, 1);
+  gho_binary_fwrite_size(file, size);
+  gho_binary_fwrite_block(file, bytes, 1, size);
+  gho_free(bytes); bytes = NULL;
+}
+
 // Input
 
 /**
@@ -150,21 +183,64 @@ gho_mpz_t gho_mpz_fread(FILE* file) {
 gho_mpz_t gho_mpz_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
   gho_mpz_t i = gho_mpz_create();
-  char* tmp = gho_c_str_create();
+  const char* const begin = *c_str;
   if (**c_str != '\0' && *(*c_str + 1) != '\0' &&
       **c_str == '-' && isdigit(*(*c_str + 1))) {
-    gho_c_str_add_char(&tmp, **c_str);
     ++(*c_str);
   }
   while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    gho_c_str_add_char(&tmp, **c_str);
     ++(*c_str);
   }
+  char* tmp = gho_c_str_create();
+  gho_c_str_add_n(&tmp, begin, (size_t)(*c_str - begin));
   mpz_set_str(i.i, tmp, 10);
   gho_c_str_destroy(&tmp);
   return i;
 }
 
+/**
+ * \brief Read a gho_mpz_t from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the gho_mpz_t read
+ * @relates gho_mpz_t
+ */
+gho_mpz_t gho_mpz_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  gho_mpz_t r = gho_mpz_sread(&token);
+  gho_reader_set_data(reader, token);
+  return r;
+}
+
+/**
+ * \brief Read a gho_mpz_t from a file with the binary format
+ * \param[in] file A C file
+ * \return the gho_mpz_t read
+ * @relates gho_mpz_t
+ */
+gho_mpz_t gho_mpz_fread_bin(FILE* file) {
+  gho_mpz_t r = gho_mpz_create();
+  unsigned char negative;
+  gho_binary_fread_block(file, &negative, 1, 1);
+  const size_t size = gho_binary_fread_size(file);
+  unsigned char* bytes = gho_array_alloc(unsigned char, size + 1);
+  gho_binary_fread_block(file, bytes, 1, size);
+  mpz_import(r.i, size, -1, 1, 0, 0, bytes);
+  if (negative != 0) { mpz_neg(r.i, r.i); }
+  gho_free(bytes); bytes = NULL;
+  return r;
+}
+
+/**
+ * \brief Read a gho_mpz_t from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized gho_mpz_t
+ * \warning Do not use this function, use gho_mpz_fread_bin
+ * @relates gho_mpz_t
+ */
+void gho_mpz_fread_bin_(FILE* file, gho_mpz_t* i) {
+  *i = gho_mpz_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -191,6 +267,21 @@ void gho_mpz_copy_(const gho_mpz_t* const i, gho_mpz_t* copy) {
   mpz_set(copy->i, i->i);
 }
 
+/**
+ * \brief Copy a gho_mpz_t with limbs of a gho_gmp_pool_t
+ * \param[in] i    A gho_mpz_t
+ * \param[in] pool A gho_gmp_pool_t
+ * \return the gho_mpz_t copied
+ * \warning gho_gmp_memory_functions_install has to be called before
+ * @relates gho_mpz_t
+ */
+gho_mpz_t gho_mpz_copy_in_pool(const gho_mpz_t* const i,
+                               gho_gmp_pool_t* pool) {
+  gho_mpz_t r;
+  gho_gmp_pool_mpz_init_set(pool, r.i, i->i);
+  return r;
+}
+
 /**
  * \brief Equality between two gho_mpz_t
  * \param[in] a A gho_mpz_t
@@ -241,6 +332,24 @@ int gho_mpz_compare_li(const gho_mpz_t* const a, const gho_lint b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a gho_mpz_t (same hash as the gho_lint if it fits)
+ * \param[in] i A gho_mpz_t
+ * \return the hash of the gho_mpz_t
+ * @relates gho_mpz_t
+ */
+size_t gho_mpz_hash(const gho_mpz_t* const i) {
+  if (mpz_fits_slong_p(i->i)) {
+    return gho_hash_ullint((unsigned long long)mpz_get_si(i->i));
+  }
+  size_t h = (size_t)mpz_sgn(i->i);
+  const size_t n = mpz_size(i->i);
+  for (size_t k = 0; k < n; ++k) {
+    h = gho_hash_combine(h, gho_hash_ullint(mpz_getlimbn(i->i, k)));
+  }
+  return h;
+}
+
 // Conversion
 
 /**
@@ -251,7 +360,9 @@ int gho_mpz_compare_li(const gho_mpz_t* const a, const gho_lint b) {
  */
 gho_string_t gho_mpz_to_string(const gho_mpz_t* const i) {
   gho_string_t r = gho_string_create();
-  gho_mpz_sprint(&r.c_str, i);
+  char* c_str = gho_c_str_create();
+  gho_mpz_sprint(&c_str, i);
+  gho_string_absorb_c_str(&r, &c_str);
   return r;
 }
 
@@ -262,17 +373,18 @@ gho_string_t gho_mpz_to_string(const gho_mpz_t* const i) {
  * @relates gho_mpz_t
  */
 gho_any_t gho_mpz_to_any(const gho_mpz_t* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_GHO_MPZ_T;
-  r.size_of_struct = sizeof(gho_mpz_t);
-  gho_mpz_t* p = gho_alloc(gho_mpz_t); gho_mpz_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_mpz_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_mpz_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_mpz_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_mpz_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_mpz_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_mpz_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_GHO_MPZ_T, sizeof(gho_mpz_t),
+    (gho_destroy_fct_t)gho_mpz_destroy,
+    (gho_fprinti_fct_t)gho_mpz_fprinti,
+    (gho_sprinti_fct_t)gho_mpz_sprinti,
+    (gho_copy_fct_t)gho_mpz_copy_,
+    (gho_equal_fct_t)gho_mpz_equal,
+    (gho_to_string_fct_t)gho_mpz_to_string,
+    (gho_fwrite_bin_fct_t)gho_mpz_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_mpz_copy_(i, (gho_mpz_t*)gho_any_data(&r));
   return r;
 }
 
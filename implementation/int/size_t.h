@@ -110,6 +110,16 @@ void gho_size_t_sprint(char** c_str, const size_t* const i) {
   gho_size_t_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a size_t in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A size_t
+ * @relates gho_size_t
+ */
+void gho_size_t_fwrite_bin(FILE* file, const size_t* const i) {
+  gho_binary_fwrite_block(file, i, sizeof(size_t), 1);
+}
+
 // Input
 
 /**
@@ -133,13 +143,48 @@ size_t gho_size_t_fread(FILE* file) {
  */
 size_t gho_size_t_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  size_t r = (size_t)atoi(*c_str);
-  while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    ++(*c_str);
-  }
+  char* end = NULL;
+  size_t r = (size_t)strtoull(*c_str, &end, 10);
+  *c_str = end;
+  return r;
+}
+
+/**
+ * \brief Read a size_t from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the size_t read
+ * @relates gho_size_t
+ */
+size_t gho_size_t_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  size_t r = gho_size_t_sread(&token);
+  gho_reader_set_data(reader, token);
   return r;
 }
 
+/**
+ * \brief Read a size_t from a file with the binary format
+ * \param[in] file A C file
+ * \return the size_t read
+ * @relates gho_size_t
+ */
+size_t gho_size_t_fread_bin(FILE* file) {
+  size_t r;
+  gho_binary_fread_block(file, &r, sizeof(size_t), 1);
+  return r;
+}
+
+/**
+ * \brief Read a size_t from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized size_t
+ * \warning Do not use this function, use gho_size_t_fread_bin
+ * @relates gho_size_t
+ */
+void gho_size_t_fread_bin_(FILE* file, size_t* i) {
+  *i = gho_size_t_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -187,6 +232,16 @@ int gho_size_t_compare(const size_t* const a, const size_t* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a size_t
+ * \param[in] i A size_t
+ * \return the hash of the size_t
+ * @relates gho_size_t
+ */
+size_t gho_size_t_hash(const size_t* const i) {
+  return gho_hash_ullint((unsigned long long)*i);
+}
+
 // Conversion
 
 /**
@@ -210,16 +265,17 @@ gho_string_t gho_size_t_to_string(const size_t* const i) {
  * @relates gho_size_t
  */
 gho_any_t gho_size_t_to_any(const size_t* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_SIZE_T;
-  r.size_of_struct = sizeof(size_t);
-  size_t* p = gho_alloc(size_t); gho_size_t_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_size_t_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_size_t_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_size_t_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_size_t_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_size_t_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_size_t_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_SIZE_T, sizeof(size_t),
+    (gho_destroy_fct_t)gho_size_t_destroy,
+    (gho_fprinti_fct_t)gho_size_t_fprinti,
+    (gho_sprinti_fct_t)gho_size_t_sprinti,
+    (gho_copy_fct_t)gho_size_t_copy_,
+    (gho_equal_fct_t)gho_size_t_equal,
+    (gho_to_string_fct_t)gho_size_t_to_string,
+    (gho_fwrite_bin_fct_t)gho_size_t_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_size_t_copy_(i, (size_t*)gho_any_data(&r));
   return r;
 }
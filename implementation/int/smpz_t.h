@@ -0,0 +1,831 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../output.h"
+#include "../../input.h"
+#include "../../c_str.h"
+#include "../../math.h"
+
+
+// Create & destroy
+
+/**
+ * \brief Return a new gho_smpz_t
+ * \return a new gho_smpz_t (0)
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_create() {
+  return gho_smpz_create_from_li(0);
+}
+
+/**
+ * \brief Return a new gho_smpz_t from a gho_lint
+ * \param[in] i A gho_lint
+ * \return a new gho_smpz_t from a gho_lint
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_create_from_li(const gho_lint i) {
+  gho_smpz_t r;
+  r.is_mpz = false;
+  r.i.small = i;
+  return r;
+}
+
+/**
+ * \brief Return a new gho_smpz_t from a gho_mpz_t
+ * \param[in] i A gho_mpz_t
+ * \return a new gho_smpz_t from a gho_mpz_t (a gho_lint if i fits)
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_create_from_mpz(const gho_mpz_t* const i) {
+  if (mpz_fits_slong_p(i->i)) {
+    return gho_smpz_create_from_li(mpz_get_si(i->i));
+  }
+  gho_smpz_t r;
+  r.is_mpz = true;
+  mpz_init_set(r.i.big, i->i);
+  return r;
+}
+
+/**
+ * \brief Destroy a gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_destroy(gho_smpz_t* i) {
+  if (i->is_mpz) {
+    mpz_clear(i->i.big);
+  }
+}
+
+/**
+ * \brief Reset a gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_reset(gho_smpz_t* i) {
+  gho_smpz_destroy(i);
+  *i = gho_smpz_create();
+}
+
+// Output
+
+/**
+ * \brief Print a gho_smpz_t in a file with indentation
+ * \param[in] file   A C file
+ * \param[in] i      A gho_smpz_t
+ * \param[in] indent Indentation (number of spaces)
+ * @relates gho_smpz_t
+ */
+void gho_smpz_fprinti(FILE* file, const gho_smpz_t* const i,
+                      const unsigned int indent) {
+  if (i->is_mpz) {
+    gho_fprinti(file, indent);
+    mpz_out_str(file, 10, i->i.big);
+  }
+  else {
+    gho_lint_fprinti(file, &i->i.small, indent);
+  }
+}
+
+/**
+ * \brief Print a gho_smpz_t in a file
+ * \param[in] file A C file
+ * \param[in] i    A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_fprint(FILE* file, const gho_smpz_t* const i) {
+  gho_smpz_fprinti(file, i, 0);
+}
+
+/**
+ * \brief Print a gho_smpz_t in stdout
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_print(const gho_smpz_t* const i) {
+  gho_smpz_fprint(stdout, i);
+}
+
+/**
+ * \brief Print a gho_smpz_t in a C string with indentation
+ * \param[in] c_str  A C string
+ * \param[in] i      A gho_smpz_t
+ * \param[in] indent Indentation (number of spaces)
+ * @relates gho_smpz_t
+ */
+void gho_smpz_sprinti(char** c_str, const gho_smpz_t* const i,
+                      const unsigned int indent) {
+  if (i->is_mpz) {
+    gho_sprinti(c_str, indent);
+    char* tmp = NULL;
+    tmp = mpz_get_str(tmp, 10, i->i.big);
+    gho_c_str_add(c_str, tmp);
+    gho_gmp_free(tmp, strlen(tmp) + 1); tmp = NULL;
+  }
+  else {
+    gho_lint_sprinti(c_str, &i->i.small, indent);
+  }
+}
+
+/**
+ * \brief Print a gho_smpz_t in a C string
+ * \param[in] c_str  A C string
+ * \param[in] i      A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_sprint(char** c_str, const gho_smpz_t* const i) {
+  gho_smpz_sprinti(c_str, i, 0);
+}
+
+/**
+ * \brief Write a gho_smpz_t in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A gho_smpz_t
+ * \note The format is the one of gho_mpz_fwrite_bin
+ * @relates gho_smpz_t
+ */
+void gho_smpz_fwrite_bin(FILE* file, const gho_smpz_t* const i) {
+  if (i->is_mpz) {
+    // Shallow copy, only read by gho_mpz_fwrite_bin
+    gho_mpz_t tmp;
+    tmp.i[0] = i->i.big[0];
+    gho_mpz_fwrite_bin(file, &tmp);
+  }
+  else {
+    const unsigned char negative = (i->i.small < 0) ? 1 : 0;
+    gho_ulint abs = (gho_ulint)i->i.small;
+    if (i->i.small < 0) { abs = -abs; }
+    unsigned char bytes[sizeof(gho_ulint)];
+    size_t size = 0;
+    while (abs != 0) {
+      bytes[size] = (unsigned char)(abs & 0xFF);
+      abs >>= 8;
+      ++size;
+    }
+    gho_binary_fwrite_block(file, &negative, 1, 1);
+    gho_binary_fwrite_size(file, size);
+    gho_binary_fwrite_block(file, bytes, 1, size);
+  }
+}
+
+// Input
+
+/**
+ * \brief Read a gho_smpz_t from a file
+ * \param[in] file A C file
+ * \return the gho_smpz_t read
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_fread(FILE* file) {
+  gho_mpz_t tmp = gho_mpz_fread(file);
+  gho_smpz_t r = gho_smpz_create_from_mpz(&tmp);
+  gho_mpz_destroy(&tmp);
+  return r;
+}
+
+/**
+ * \brief Read a gho_smpz_t from a C string
+ * \param[in] c_str A C string
+ * \return the gho_smpz_t read
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_sread(const char** c_str) {
+  gho_mpz_t tmp = gho_mpz_sread(c_str);
+  gho_smpz_t r = gho_smpz_create_from_mpz(&tmp);
+  gho_mpz_destroy(&tmp);
+  return r;
+}
+
+/**
+ * \brief Read a gho_smpz_t from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the gho_smpz_t read
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  gho_smpz_t r = gho_smpz_sread(&token);
+  gho_reader_set_data(reader, token);
+  return r;
+}
+
+/**
+ * \brief Read a gho_smpz_t from a file with the binary format
+ * \param[in] file A C file
+ * \return the gho_smpz_t read
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_fread_bin(FILE* file) {
+  gho_mpz_t tmp = gho_mpz_fread_bin(file);
+  gho_smpz_t r = gho_smpz_create_from_mpz(&tmp);
+  gho_mpz_destroy(&tmp);
+  return r;
+}
+
+/**
+ * \brief Read a gho_smpz_t from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized gho_smpz_t
+ * \warning Do not use this function, use gho_smpz_fread_bin
+ * @relates gho_smpz_t
+ */
+void gho_smpz_fread_bin_(FILE* file, gho_smpz_t* i) {
+  *i = gho_smpz_fread_bin(file);
+}
+
+// Copy & comparisons
+
+/**
+ * \brief Copy a gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * \return the gho_smpz_t copied
+ * @relates gho_smpz_t
+ */
+gho_smpz_t gho_smpz_copy(const gho_smpz_t* const i) {
+  gho_smpz_t r;
+  gho_smpz_copy_(i, &r);
+  return r;
+}
+
+/**
+ * \brief Copy a gho_smpz_t
+ * \param[in] i    A gho_smpz_t
+ * \param[in] copy A pointer on an not initialized gho_smpz_t
+ * \warning Do not use this function, use gho_smpz_copy
+ * @relates gho_smpz_t
+ */
+void gho_smpz_copy_(const gho_smpz_t* const i, gho_smpz_t* copy) {
+  copy->is_mpz = i->is_mpz;
+  if (i->is_mpz) {
+    mpz_init_set(copy->i.big, i->i.big);
+  }
+  else {
+    copy->i.small = i->i.small;
+  }
+}
+
+/**
+ * \brief Equality between two gho_smpz_t
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_smpz_t
+ * \return true if the gho_smpz_t are equals, false otherwise
+ * @relates gho_smpz_t
+ */
+bool gho_smpz_equal(const gho_smpz_t* const a, const gho_smpz_t* const b) {
+  return gho_smpz_compare(a, b) == 0;
+}
+
+/**
+ * \brief Equality between a gho_smpz_t and a gho_lint
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_lint
+ * \return true if the gho_smpz_t and the gho_lint are equals, false otherwise
+ * @relates gho_smpz_t
+ */
+bool gho_smpz_equal_li(const gho_smpz_t* const a, const gho_lint b) {
+  return gho_smpz_compare_li(a, b) == 0;
+}
+
+/**
+ * \brief Compare two gho_smpz_t
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_smpz_t
+ * \return -1 if a < b, 0 if a == b, 1 if a > b
+ * @relates gho_smpz_t
+ */
+int gho_smpz_compare(const gho_smpz_t* const a, const gho_smpz_t* const b) {
+  if (b->is_mpz == false) {
+    return gho_smpz_compare_li(a, b->i.small);
+  }
+  else if (a->is_mpz == false) {
+    return -gho_smpz_compare_li(b, a->i.small);
+  }
+  else {
+    const int c = mpz_cmp(a->i.big, b->i.big);
+    if (c < 0) { return -1; }
+    else if (c > 0) { return 1; }
+    else { return 0; }
+  }
+}
+
+/**
+ * \brief Compare a gho_smpz_t and a gho_lint
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_lint
+ * \return -1 if a < b, 0 if a == b, 1 if a > b
+ * @relates gho_smpz_t
+ */
+int gho_smpz_compare_li(const gho_smpz_t* const a, const gho_lint b) {
+  if (a->is_mpz == false) {
+    if (a->i.small < b) { return -1; }
+    else if (a->i.small > b) { return 1; }
+    else { return 0; }
+  }
+  const int c = mpz_cmp_si(a->i.big, b);
+  if (c < 0) { return -1; }
+  else if (c > 0) { return 1; }
+  else { return 0; }
+}
+
+/**
+ * \brief Compare a gho_smpz_t and a gho_mpz_t
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_mpz_t
+ * \return -1 if a < b, 0 if a == b, 1 if a > b
+ * @relates gho_smpz_t
+ */
+int gho_smpz_compare_mpz(const gho_smpz_t* const a, const gho_mpz_t* const b) {
+  if (a->is_mpz == false) {
+    return -gho_mpz_compare_li(b, a->i.small);
+  }
+  const int c = mpz_cmp(a->i.big, b->i);
+  if (c < 0) { return -1; }
+  else if (c > 0) { return 1; }
+  else { return 0; }
+}
+
+/**
+ * \brief Hash a gho_smpz_t (same hash as the gho_mpz_t)
+ * \param[in] i A gho_smpz_t
+ * \return the hash of the gho_smpz_t
+ * @relates gho_smpz_t
+ */
+size_t gho_smpz_hash(const gho_smpz_t* const i) {
+  if (i->is_mpz == false) {
+    return gho_hash_ullint((unsigned long long)i->i.small);
+  }
+  gho_mpz_t big;
+  big.i[0] = i->i.big[0];
+  return gho_mpz_hash(&big);
+}
+
+// Conversion
+
+/**
+ * \brief Return true if the gho_smpz_t fits in a gho_lint
+ * \param[in] i A gho_smpz_t
+ * \return true if the gho_smpz_t fits in a gho_lint, false otherwise
+ * @relates gho_smpz_t
+ */
+bool gho_smpz_fits_li(const gho_smpz_t* const i) {
+  return i->is_mpz == false || mpz_fits_slong_p(i->i.big);
+}
+
+/**
+ * \brief Convert a gho_smpz_t into a gho_lint
+ * \param[in] i A gho_smpz_t which fits in a gho_lint
+ * \return the gho_lint from the gho_smpz_t
+ * @relates gho_smpz_t
+ */
+gho_lint gho_smpz_get_li(const gho_smpz_t* const i) {
+  if (i->is_mpz == false) {
+    return i->i.small;
+  }
+  #ifndef NDEBUG
+  if (mpz_fits_slong_p(i->i.big) == false) {
+    fprintf(stderr, "ERROR: gho_smpz_get_li(gho_smpz_t) overflow!\n");
+    exit(1);
+  }
+  #endif
+  return mpz_get_si(i->i.big);
+}
+
+/**
+ * \brief Convert a gho_smpz_t into a gho_mpz_t
+ * \param[in] i A gho_smpz_t
+ * \return the gho_mpz_t from the gho_smpz_t
+ * @relates gho_smpz_t
+ */
+gho_mpz_t gho_smpz_to_mpz(const gho_smpz_t* const i) {
+  gho_mpz_t r;
+  if (i->is_mpz) { mpz_init_set(r.i, i->i.big); }
+  else { mpz_init_set_si(r.i, i->i.small); }
+  return r;
+}
+
+/**
+ * \brief Convert a gho_smpz_t into a gho_string
+ * \param[in] i A gho_smpz_t
+ * \return the gho_string from the gho_smpz_t
+ * @relates gho_smpz_t
+ */
+gho_string_t gho_smpz_to_string(const gho_smpz_t* const i) {
+  gho_string_t r = gho_string_create();
+  char* c_str = gho_c_str_create();
+  gho_smpz_sprint(&c_str, i);
+  gho_string_absorb_c_str(&r, &c_str);
+  return r;
+}
+
+/**
+ * \brief Convert a gho_smpz_t into a gho_any
+ * \param[in] i A gho_smpz_t
+ * \return the gho_any from the gho_smpz_t
+ * @relates gho_smpz_t
+ */
+gho_any_t gho_smpz_to_any(const gho_smpz_t* const i) {
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_GHO_SMPZ_T, sizeof(gho_smpz_t),
+    (gho_destroy_fct_t)gho_smpz_destroy,
+    (gho_fprinti_fct_t)gho_smpz_fprinti,
+    (gho_sprinti_fct_t)gho_smpz_sprinti,
+    (gho_copy_fct_t)gho_smpz_copy_,
+    (gho_equal_fct_t)gho_smpz_equal,
+    (gho_to_string_fct_t)gho_smpz_to_string,
+    (gho_fwrite_bin_fct_t)gho_smpz_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_smpz_copy_(i, (gho_smpz_t*)gho_any_data(&r));
+  return r;
+}
+
+// Set
+
+/**
+ * \brief a = b
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_set(gho_smpz_t* a, const gho_smpz_t* const b) {
+  if (b->is_mpz == false) {
+    gho_smpz_set_li(a, b->i.small);
+  }
+  else if (a != b) {
+    gho_smpz_promote_(a);
+    mpz_set(a->i.big, b->i.big);
+  }
+}
+
+/**
+ * \brief a = b
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_set_li(gho_smpz_t* a, const gho_lint b) {
+  if (a->is_mpz) { mpz_set_si(a->i.big, b); }
+  else { a->i.small = b; }
+}
+
+/**
+ * \brief a = b
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_mpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_set_mpz(gho_smpz_t* a, const gho_mpz_t* const b) {
+  if (a->is_mpz) {
+    mpz_set(a->i.big, b->i);
+  }
+  else {
+    *a = gho_smpz_create_from_mpz(b);
+  }
+}
+
+// Swap
+
+/**
+ * \brief Swap a and b
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_swap(gho_smpz_t* a, gho_smpz_t* b) {
+  const gho_smpz_t tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+// Arithmetic
+
+/**
+ * \brief Store i in a mpz_t
+ * \param[in] i A gho_smpz_t
+ * \warning Do not use this function, it is used when a result does not fit in
+ *          a gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_promote_(gho_smpz_t* i) {
+  if (i->is_mpz == false) {
+    const gho_lint small = i->i.small;
+    mpz_init_set_si(i->i.big, small);
+    i->is_mpz = true;
+  }
+}
+
+/**
+ * \brief Store i in a gho_lint if it fits
+ * \param[in] i A gho_smpz_t
+ * \warning Do not use this function, it is used when a result fits again in a
+ *          gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_demote_(gho_smpz_t* i) {
+  if (i->is_mpz && mpz_fits_slong_p(i->i.big)) {
+    const gho_lint small = mpz_get_si(i->i.big);
+    mpz_clear(i->i.big);
+    i->is_mpz = false;
+    i->i.small = small;
+  }
+}
+
+/**
+ * \brief r += i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_add(gho_smpz_t* r, const gho_smpz_t* const i) {
+  if (i->is_mpz == false) {
+    gho_smpz_add_li(r, i->i.small);
+  }
+  else {
+    gho_smpz_promote_(r);
+    mpz_add(r->i.big, r->i.big, i->i.big);
+    gho_smpz_demote_(r);
+  }
+}
+
+/**
+ * \brief r -= i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_sub(gho_smpz_t* r, const gho_smpz_t* const i) {
+  if (i->is_mpz == false) {
+    gho_smpz_sub_li(r, i->i.small);
+  }
+  else {
+    gho_smpz_promote_(r);
+    mpz_sub(r->i.big, r->i.big, i->i.big);
+    gho_smpz_demote_(r);
+  }
+}
+
+/**
+ * \brief r *= i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_mul(gho_smpz_t* r, const gho_smpz_t* const i) {
+  if (i->is_mpz == false) {
+    gho_smpz_mul_li(r, i->i.small);
+  }
+  else {
+    gho_smpz_promote_(r);
+    mpz_mul(r->i.big, r->i.big, i->i.big);
+    gho_smpz_demote_(r);
+  }
+}
+
+/**
+ * \brief r += i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_add_li(gho_smpz_t* r, const gho_lint i) {
+  if (r->is_mpz == false) {
+    gho_lint tmp;
+    if (gho_lint_add_overflow(r->i.small, i, &tmp) == false) {
+      r->i.small = tmp;
+      return;
+    }
+    gho_smpz_promote_(r);
+  }
+  if (i >= 0) { mpz_add_ui(r->i.big, r->i.big, (gho_ulint)i); }
+  else { mpz_sub_ui(r->i.big, r->i.big, -(gho_ulint)i); }  gho_smpz_demote_(r);
+}
+
+/**
+ * \brief r -= i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_sub_li(gho_smpz_t* r, const gho_lint i) {
+  if (r->is_mpz == false) {
+    gho_lint tmp;
+    if (gho_lint_sub_overflow(r->i.small, i, &tmp) == false) {
+      r->i.small = tmp;
+      return;
+    }
+    gho_smpz_promote_(r);
+  }
+  if (i >= 0) { mpz_sub_ui(r->i.big, r->i.big, (gho_ulint)i); }
+  else { mpz_add_ui(r->i.big, r->i.big, -(gho_ulint)i); }  gho_smpz_demote_(r);
+}
+
+/**
+ * \brief r *= i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_mul_li(gho_smpz_t* r, const gho_lint i) {
+  if (r->is_mpz == false) {
+    gho_lint tmp;
+    if (gho_lint_mul_overflow(r->i.small, i, &tmp) == false) {
+      r->i.small = tmp;
+      return;
+    }
+    gho_smpz_promote_(r);
+  }
+  mpz_mul_si(r->i.big, r->i.big, i);  gho_smpz_demote_(r);
+}
+
+/**
+ * \brief r += i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_mpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_add_mpz(gho_smpz_t* r, const gho_mpz_t* const i) {
+  gho_smpz_promote_(r);
+  mpz_add(r->i.big, r->i.big, i->i);
+  gho_smpz_demote_(r);
+}
+
+/**
+ * \brief r -= i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_mpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_sub_mpz(gho_smpz_t* r, const gho_mpz_t* const i) {
+  gho_smpz_promote_(r);
+  mpz_sub(r->i.big, r->i.big, i->i);
+  gho_smpz_demote_(r);
+}
+
+/**
+ * \brief r *= i
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_mpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_mul_mpz(gho_smpz_t* r, const gho_mpz_t* const i) {
+  gho_smpz_promote_(r);
+  mpz_mul(r->i.big, r->i.big, i->i);
+  gho_smpz_demote_(r);
+}
+
+/**
+ * \brief i = -i
+ * \param[in] i A gho_smpz_t
+ * @relates gho_smpz_t
+ */
+void gho_smpz_neg(gho_smpz_t* i) {
+  if (i->is_mpz == false && i->i.small != LONG_MIN) {
+    i->i.small = -i->i.small;
+    return;
+  }
+  gho_smpz_promote_(i);
+  mpz_neg(i->i.big, i->i.big);
+}
+
+/**
+ * \brief r = greatest_common_divisor(r, i), >= 0
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_smpz_t
+ * \note The gcd is computed on machine integers when r and i are not mpz_t,
+ *       with mpz_gcd otherwise
+ * @relates gho_smpz_t
+ */
+void gho_smpz_gcd(gho_smpz_t* r, const gho_smpz_t* const i) {
+  if (i->is_mpz == false) {
+    gho_smpz_gcd_li(r, i->i.small);
+  }
+  else {
+    gho_smpz_promote_(r);
+    mpz_gcd(r->i.big, r->i.big, i->i.big);
+  }
+}
+
+/**
+ * \brief r = greatest_common_divisor(r, i), >= 0
+ * \param[in] r A gho_smpz_t
+ * \param[in] i A gho_lint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_gcd_li(gho_smpz_t* r, const gho_lint i) {
+  const gho_ulint i_abs = (i < 0) ? -(gho_ulint)i : (gho_ulint)i;
+  if (r->is_mpz == false) {
+    const gho_ulint r_abs =
+      (r->i.small < 0) ? -(gho_ulint)r->i.small : (gho_ulint)r->i.small;
+    const gho_ulint g = (gho_ulint)gho_ullint_gcd(r_abs, i_abs);
+    if (g <= (gho_ulint)LONG_MAX) {
+      r->i.small = (gho_lint)g;
+      return;
+    }
+    // gcd(LONG_MIN, 0) or gcd(LONG_MIN, LONG_MIN)
+    mpz_init_set_ui(r->i.big, g);
+    r->is_mpz = true;
+    return;
+  }
+  if (i_abs != 0) {
+    mpz_set_ui(r->i.big, mpz_gcd_ui(NULL, r->i.big, i_abs));
+  }
+  else {
+    mpz_abs(r->i.big, r->i.big);
+  }
+}
+
+/**
+ * \brief Return true if a is divisible by b (only 0 is divisible by 0)
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_smpz_t
+ * \return true if a is divisible by b
+ * @relates gho_smpz_t
+ */
+bool gho_smpz_is_divisible(const gho_smpz_t* const a,
+                           const gho_smpz_t* const b) {
+  if (b->is_mpz == false) {
+    return gho_smpz_is_divisible_li(a, b->i.small);
+  }
+  if (a->is_mpz) {
+    return mpz_divisible_p(a->i.big, b->i.big) != 0;
+  }
+  if (mpz_fits_slong_p(b->i.big)) {
+    return gho_smpz_is_divisible_li(a, mpz_get_si(b->i.big));
+  }
+  // |b| > LONG_MAX and |a| <= |LONG_MIN|
+  const gho_ulint a_abs =
+    (a->i.small < 0) ? -(gho_ulint)a->i.small : (gho_ulint)a->i.small;
+  return a_abs == 0 || mpz_cmpabs_ui(b->i.big, a_abs) == 0;
+}
+
+/**
+ * \brief Return true if a is divisible by b (only 0 is divisible by 0)
+ * \param[in] a A gho_smpz_t
+ * \param[in] b A gho_lint
+ * \return true if a is divisible by b
+ * @relates gho_smpz_t
+ */
+bool gho_smpz_is_divisible_li(const gho_smpz_t* const a, const gho_lint b) {
+  const gho_ulint b_abs = (b < 0) ? -(gho_ulint)b : (gho_ulint)b;
+  if (a->is_mpz) {
+    return mpz_divisible_ui_p(a->i.big, b_abs) != 0;
+  }
+  const gho_ulint a_abs =
+    (a->i.small < 0) ? -(gho_ulint)a->i.small : (gho_ulint)a->i.small;
+  return gho_ullint_is_divisible(a_abs, b_abs);
+}
+
+/**
+ * \brief r = r ^ e
+ * \param[in] r A gho_smpz_t
+ * \param[in] e A gho_ulint
+ * @relates gho_smpz_t
+ */
+void gho_smpz_pow_ui(gho_smpz_t* r, const gho_ulint e) {
+  if (r->is_mpz == false) {
+    gho_lint tmp;
+    if (gho_lint_pow_overflow(r->i.small, e, &tmp) == false) {
+      r->i.small = tmp;
+      return;
+    }
+    gho_smpz_promote_(r);
+  }
+  mpz_pow_ui(r->i.big, r->i.big, e);
+}
+
+/**
+ * \brief r = r ^ e modulo m, in [0, |m|)
+ * \param[in] r A gho_smpz_t
+ * \param[in] e A gho_ulint
+ * \param[in] m A gho_smpz_t (m != 0)
+ * @relates gho_smpz_t
+ */
+void gho_smpz_pow_mod(gho_smpz_t* r, const gho_ulint e,
+                      const gho_smpz_t* const m) {
+  if (r->is_mpz == false && m->is_mpz == false) {
+    r->i.small = gho_lint_pow_mod(r->i.small, e, m->i.small);
+    return;
+  }
+  gho_smpz_promote_(r);
+  gho_mpz_t m_mpz = gho_smpz_to_mpz(m);
+  mpz_abs(m_mpz.i, m_mpz.i);
+  mpz_powm_ui(r->i.big, r->i.big, e, m_mpz.i);
+  gho_mpz_destroy(&m_mpz);
+}
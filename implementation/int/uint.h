@@ -110,6 +110,16 @@ void gho_uint_sprint(char** c_str, const gho_uint* const i) {
   gho_uint_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a unsigned int in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A unsigned int
+ * @relates gho_uint
+ */
+void gho_uint_fwrite_bin(FILE* file, const gho_uint* const i) {
+  gho_binary_fwrite_block(file, i, sizeof(gho_uint), 1);
+}
+
 // Input
 
 /**
@@ -133,13 +143,48 @@ gho_uint gho_uint_fread(FILE* file) {
  */
 gho_uint gho_uint_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  gho_uint r = (gho_uint)atoi(*c_str);
-  while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    ++(*c_str);
-  }
+  char* end = NULL;
+  gho_uint r = (gho_uint)strtoul(*c_str, &end, 10);
+  *c_str = end;
+  return r;
+}
+
+/**
+ * \brief Read a unsigned int from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the unsigned int read
+ * @relates gho_uint
+ */
+gho_uint gho_uint_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  gho_uint r = gho_uint_sread(&token);
+  gho_reader_set_data(reader, token);
   return r;
 }
 
+/**
+ * \brief Read a unsigned int from a file with the binary format
+ * \param[in] file A C file
+ * \return the unsigned int read
+ * @relates gho_uint
+ */
+gho_uint gho_uint_fread_bin(FILE* file) {
+  gho_uint r;
+  gho_binary_fread_block(file, &r, sizeof(gho_uint), 1);
+  return r;
+}
+
+/**
+ * \brief Read a unsigned int from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized gho_uint
+ * \warning Do not use this function, use gho_uint_fread_bin
+ * @relates gho_uint
+ */
+void gho_uint_fread_bin_(FILE* file, gho_uint* i) {
+  *i = gho_uint_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -187,6 +232,16 @@ int gho_uint_compare(const gho_uint* const a, const gho_uint* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a unsigned int
+ * \param[in] i A unsigned int
+ * \return the hash of the unsigned int
+ * @relates gho_uint
+ */
+size_t gho_uint_hash(const gho_uint* const i) {
+  return gho_hash_ullint((unsigned long long)*i);
+}
+
 // Conversion
 
 /**
@@ -210,16 +265,17 @@ gho_string_t gho_uint_to_string(const gho_uint* const i) {
  * @relates gho_uint
  */
 gho_any_t gho_uint_to_any(const gho_uint* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_UINT;
-  r.size_of_struct = sizeof(gho_uint);
-  gho_uint* p = gho_alloc(gho_uint); gho_uint_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_uint_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_uint_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_uint_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_uint_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_uint_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_uint_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_UINT, sizeof(gho_uint),
+    (gho_destroy_fct_t)gho_uint_destroy,
+    (gho_fprinti_fct_t)gho_uint_fprinti,
+    (gho_sprinti_fct_t)gho_uint_sprinti,
+    (gho_copy_fct_t)gho_uint_copy_,
+    (gho_equal_fct_t)gho_uint_equal,
+    (gho_to_string_fct_t)gho_uint_to_string,
+    (gho_fwrite_bin_fct_t)gho_uint_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_uint_copy_(i, (gho_uint*)gho_any_data(&r));
   return r;
 }
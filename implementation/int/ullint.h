@@ -110,6 +110,16 @@ void gho_ullint_sprint(char** c_str, const gho_ullint* const i) {
   gho_ullint_sprinti(c_str, i, 0);
 }
 
+/**
+ * \brief Write a unsigned long int in a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A unsigned long int
+ * @relates gho_ullint
+ */
+void gho_ullint_fwrite_bin(FILE* file, const gho_ullint* const i) {
+  gho_binary_fwrite_block(file, i, sizeof(gho_ullint), 1);
+}
+
 // Input
 
 /**
@@ -133,13 +143,48 @@ gho_ullint gho_ullint_fread(FILE* file) {
  */
 gho_ullint gho_ullint_sread(const char** c_str) {
   gho_read_whitespace_from_c_str(c_str);
-  gho_ullint r = (gho_ullint)atoi(*c_str);
-  while (**c_str != '\0' && isspace(**c_str) == 0 && isdigit(**c_str)) {
-    ++(*c_str);
-  }
+  char* end = NULL;
+  gho_ullint r = (gho_ullint)strtoull(*c_str, &end, 10);
+  *c_str = end;
+  return r;
+}
+
+/**
+ * \brief Read a unsigned long int from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the unsigned long int read
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_rread(gho_reader_t* reader) {
+  const char* token = gho_reader_token(reader);
+  gho_ullint r = gho_ullint_sread(&token);
+  gho_reader_set_data(reader, token);
+  return r;
+}
+
+/**
+ * \brief Read a unsigned long int from a file with the binary format
+ * \param[in] file A C file
+ * \return the unsigned long int read
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_fread_bin(FILE* file) {
+  gho_ullint r;
+  gho_binary_fread_block(file, &r, sizeof(gho_ullint), 1);
   return r;
 }
 
+/**
+ * \brief Read a unsigned long int from a file with the binary format
+ * \param[in] file A C file
+ * \param[in] i    A pointer on an not initialized gho_ullint
+ * \warning Do not use this function, use gho_ullint_fread_bin
+ * @relates gho_ullint
+ */
+void gho_ullint_fread_bin_(FILE* file, gho_ullint* i) {
+  *i = gho_ullint_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -187,6 +232,16 @@ int gho_ullint_compare(const gho_ullint* const a, const gho_ullint* const b) {
   else { return 0; }
 }
 
+/**
+ * \brief Hash a unsigned long long int
+ * \param[in] i A unsigned long long int
+ * \return the hash of the unsigned long long int
+ * @relates gho_ullint
+ */
+size_t gho_ullint_hash(const gho_ullint* const i) {
+  return gho_hash_ullint((unsigned long long)*i);
+}
+
 // Conversion
 
 /**
@@ -210,16 +265,17 @@ gho_string_t gho_ullint_to_string(const gho_ullint* const i) {
  * @relates gho_ullint
  */
 gho_any_t gho_ullint_to_any(const gho_ullint* const i) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_ULINT;
-  r.size_of_struct = sizeof(gho_ullint);
-  gho_ullint* p = gho_alloc(gho_ullint); gho_ullint_copy_(i, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_ullint_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_ullint_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_ullint_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_ullint_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_ullint_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_ullint_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_ULINT, sizeof(gho_ullint),
+    (gho_destroy_fct_t)gho_ullint_destroy,
+    (gho_fprinti_fct_t)gho_ullint_fprinti,
+    (gho_sprinti_fct_t)gho_ullint_sprinti,
+    (gho_copy_fct_t)gho_ullint_copy_,
+    (gho_equal_fct_t)gho_ullint_equal,
+    (gho_to_string_fct_t)gho_ullint_to_string,
+    (gho_fwrite_bin_fct_t)gho_ullint_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_ullint_copy_(i, (gho_ullint*)gho_any_data(&r));
   return r;
 }
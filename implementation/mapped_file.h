@@ -0,0 +1,213 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../memory.h"
+#include "../unused.h"
+
+// mmap with gho_unix (defined by the CMake build) or, when gho_unix is not
+// defined, on a Unix-like system
+#ifdef gho_unix
+  #define gho_mapped_file_mmap_ gho_unix
+#elif defined(__unix__) || defined(__unix) || \
+      (defined(__APPLE__) && defined(__MACH__))
+  #define gho_mapped_file_mmap_ 1
+#else
+  #define gho_mapped_file_mmap_ 0
+#endif
+
+#if gho_mapped_file_mmap_
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+
+// Create & destroy
+
+/**
+ * \brief Map a file in memory
+ * \param[in] file A gho_mapped_file_t with c_str == NULL
+ * \param[in] path Path of the file
+ * \return true if the file is mapped, false if it has to be read
+ * \warning Do not use this function, use gho_mapped_file_create
+ * @relates gho_mapped_file_t
+ */
+bool gho_mapped_file_map_(gho_mapped_file_t* file, const char* const path) {
+  #if gho_mapped_file_mmap_
+
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) { return false; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || S_ISREG(st.st_mode) == 0 || st.st_size == 0) {
+      close(fd);
+      return false;
+    }
+    const size_t size = (size_t)st.st_size;
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    void* memory = MAP_FAILED;
+    size_t memory_size = size;
+    // The rest of the last page of a file mapping is filled with 0, the '\0'
+    // is there
+    if (size % page_size != 0) {
+      memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // The file ends at the end of a page: one more page for the '\0' (without
+    // MAP_ANONYMOUS or MAP_ANON, for example with a strict -std=c99, the file
+    // is read)
+    else {
+      #if defined(MAP_ANONYMOUS) || defined(MAP_ANON)
+        #ifdef MAP_ANONYMOUS
+          const int map_anonymous = MAP_ANONYMOUS;
+        #else
+          const int map_anonymous = MAP_ANON;
+        #endif
+        memory_size = size + page_size;
+        memory = mmap(NULL, memory_size, PROT_READ,
+                      MAP_PRIVATE | map_anonymous, -1, 0);
+        if (memory != MAP_FAILED &&
+            mmap(memory, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0)
+            == MAP_FAILED) {
+          munmap(memory, memory_size);
+          memory = MAP_FAILED;
+        }
+      #endif
+    }
+    if (memory == MAP_FAILED) { close(fd); return false; }
+    close(fd);
+    #ifdef POSIX_MADV_SEQUENTIAL
+      posix_madvise(memory, size, POSIX_MADV_SEQUENTIAL);
+    #endif
+    file->c_str = (const char*)memory;
+    file->size = size;
+    file->memory = memory;
+    file->memory_size = memory_size;
+    file->mapped = true;
+    return true;
+
+  #else
+
+    gho_unused(file);
+    gho_unused(path);
+    return false;
+
+  #endif
+}
+
+/**
+ * \brief Return a new gho_mapped_file_t
+ * \param[in] path Path of the file
+ * \return a new gho_mapped_file_t
+ * @relates gho_mapped_file_t
+ */
+gho_mapped_file_t gho_mapped_file_create(const char* const path) {
+  gho_mapped_file_t file;
+  file.c_str = NULL;
+  file.size = 0;
+  file.memory = NULL;
+  file.memory_size = 0;
+  file.mapped = false;
+  if (gho_mapped_file_map_(&file, path)) { return file; }
+  // Read the file in an array
+  FILE* f = fopen(path, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "ERROR: gho_mapped_file_create: can not open \"%s\"!\n",
+            path);
+    exit(1);
+  }
+  char* array = gho_array_alloc(char, 1);
+  size_t capacity = 0;
+  while (true) {
+    if (file.size == capacity) {
+      capacity = gho_growth(capacity, capacity + 65536);
+      gho_array_realloc(array, char, capacity + 1);
+    }
+    const size_t n = fread(array + file.size, 1, capacity - file.size, f);
+    if (n == 0) { break; }
+    file.size += n;
+  }
+  fclose(f);
+  array[file.size] = '\0';
+  file.c_str = array;
+  file.memory = array;
+  file.memory_size = capacity + 1;
+  return file;
+}
+
+/**
+ * \brief Destroy a gho_mapped_file_t
+ * \param[in] file A gho_mapped_file_t
+ * @relates gho_mapped_file_t
+ */
+void gho_mapped_file_destroy(gho_mapped_file_t* file) {
+  #if gho_mapped_file_mmap_
+    if (file->mapped) { munmap(file->memory, file->memory_size); }
+    else { gho_free(file->memory); }
+  #else
+    gho_free(file->memory);
+  #endif
+  file->c_str = NULL;
+  file->size = 0;
+  file->memory = NULL;
+  file->memory_size = 0;
+  file->mapped = false;
+}
+
+// Get
+
+/**
+ * \brief Return the first char of the file
+ * \param[in] file A gho_mapped_file_t
+ * \return the first char of the file (the chars are followed by a '\0')
+ * @relates gho_mapped_file_t
+ */
+const char* gho_mapped_file_c_str(const gho_mapped_file_t* const file) {
+  return file->c_str;
+}
+
+/**
+ * \brief Return the end of the file
+ * \param[in] file A gho_mapped_file_t
+ * \return a pointer after the last char of the file
+ * @relates gho_mapped_file_t
+ */
+const char* gho_mapped_file_end(const gho_mapped_file_t* const file) {
+  return file->c_str + file->size;
+}
+
+// Size
+
+/**
+ * \brief Return the size of the file
+ * \param[in] file A gho_mapped_file_t
+ * \return the number of chars of the file
+ * @relates gho_mapped_file_t
+ */
+size_t gho_mapped_file_size(const gho_mapped_file_t* const file) {
+  return file->size;
+}
+
+/**
+ * \brief Return true if the file is empty, false otherwise
+ * \param[in] file A gho_mapped_file_t
+ * \return true if the file is empty, false otherwise
+ * @relates gho_mapped_file_t
+ */
+bool gho_mapped_file_empty(const gho_mapped_file_t* const file) {
+  return file->size == 0;
+}
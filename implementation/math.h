@@ -13,6 +13,11 @@
 // limitations under the License.
 
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+
 // abs
 
 #ifdef gho_with_gmp
@@ -31,82 +36,95 @@ gho_mpz_t gho_mpz_abs(const gho_mpz_t i) {
 
 // gcd
 
+// Euclid's algorithm on the absolute values (iterative): with a hardware
+// division, it is faster than the binary gcd (Stein)
 // http://en.wikipedia.org/wiki/Greatest_common_divisor
 // https://proofwiki.org/wiki/GCD_for_Negative_Integers
 
-static inline
-int gho_int_gcd_without_abs(const int a, const int b);
+/**
+ * @brief Return the number of trailing zeros of i
+ * @param[in] i A gho_ullint (i != 0)
+ * @return the number of trailing zeros of i
+ * @warning Do not use this function, it is used by gho_divider_t and the
+ *          divisibility tests
+ * @relates gho_ullint
+ */
+int gho_ullint_ctz_(const gho_ullint i) {
+  #if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(i);
+  #else
+    int n = 0;
+    gho_ullint v = i;
+    while ((v & 1) == 0) { v >>= 1; ++n; }
+    return n;
+  #endif
+}
 
 /**
- * @brief Almost greatest common divisor of int (result can be negative)
- * @param[in] a A int
- * @param[in] b A int
- * @return almost the greatest common divisor of int (result can be negative)
- * @relates gho_int
+ * @brief Greatest common divisor of gho_ullint
+ * @param[in] a A gho_ullint
+ * @param[in] b A gho_ullint
+ * @return Greatest common divisor of gho_ullint (0 if a == b == 0)
+ * @relates gho_ullint
  */
-int gho_int_gcd_without_abs(const int a, const int b) {
-  return (b != 0) ? gho_int_gcd_without_abs(b, a % b) : a;
+gho_ullint gho_ullint_gcd(const gho_ullint a, const gho_ullint b) {
+  gho_ullint u = a;
+  gho_ullint v = b;
+  // The 32-bit division is faster: the end is done on unsigned int
+  while (v != 0 && (u | v) > UINT_MAX) {
+    const gho_ullint r = u % v;
+    u = v;
+    v = r;
+  }
+  unsigned int u_32 = (unsigned int)u;
+  unsigned int v_32 = (unsigned int)v;
+  while (v_32 != 0) {
+    const unsigned int r = u_32 % v_32;
+    u_32 = v_32;
+    v_32 = r;
+  }
+  return (v == 0) ? u : u_32;
 }
 
 /**
  * @brief Greatest common divisor of int
  * @param[in] a A int
  * @param[in] b A int
- * @return Greatest common divisor of int
+ * @return Greatest common divisor of int (>= 0, except gcd(INT_MIN, 0) and
+ *         gcd(INT_MIN, INT_MIN) which return INT_MIN: 2^31 does not fit)
  * @relates gho_int
  */
 int gho_int_gcd(const int a, const int b) {
-  return (b != 0) ? gho_int_gcd_without_abs(b, a % b) : a;
-}
-
-static inline
-gho_lint gho_lint_gcd_without_abs(const gho_lint a, const gho_lint b);
-
-/**
- * @brief Almost greatest common divisor of gho_lint (result can be negative)
- * @param[in] a A gho_lint
- * @param[in] b A gho_lint
- * @return almost the greatest common divisor of gho_lint (result can be negative)
- * @relates gho_lint
- */
-gho_lint gho_lint_gcd_without_abs(const gho_lint a, const gho_lint b) {
-  return (b != 0) ? gho_lint_gcd_without_abs(b, a % b) : a;
+  return (int)gho_llint_gcd(a, b);
 }
 
 /**
  * @brief Greatest common divisor of gho_lint
  * @param[in] a A gho_lint
  * @param[in] b A gho_lint
- * @return Greatest common divisor of gho_lint
+ * @return Greatest common divisor of gho_lint (>= 0, except gcd(LONG_MIN, 0)
+ *         and gcd(LONG_MIN, LONG_MIN) which return LONG_MIN: -LONG_MIN does
+ *         not fit)
  * @relates gho_lint
  */
 gho_lint gho_lint_gcd(const gho_lint a, const gho_lint b) {
-  return (b != 0) ? gho_lint_gcd_without_abs(b, a % b) : a;
-}
-
-static inline
-gho_llint gho_llint_gcd_without_abs(const gho_llint a, const gho_llint b);
-
-/**
- * @brief Almost greatest common divisor of gho_llint (result can be negative)
- * @param[in] a A gho_llint
- * @param[in] b A gho_llint
- * @return almost the greatest common divisor of gho_llint (result can be negative)
- * @relates gho_llint
- */
-gho_llint gho_llint_gcd_without_abs(const gho_llint a, const gho_llint b) {
-  return (b != 0) ? gho_llint_gcd_without_abs(b, a % b) : a;
+  return (gho_lint)gho_llint_gcd(a, b);
 }
 
 /**
  * @brief Greatest common divisor of gho_llint
  * @param[in] a A gho_llint
  * @param[in] b A gho_llint
- * @return Greatest common divisor of gho_llint
+ * @return Greatest common divisor of gho_llint (>= 0, except
+ *         gcd(LLONG_MIN, 0) and gcd(LLONG_MIN, LLONG_MIN) which return
+ *         LLONG_MIN: 2^63 does not fit)
+ * \note Use gho_ullint_gcd on the absolute values to get 2^63
  * @relates gho_llint
  */
 gho_llint gho_llint_gcd(const gho_llint a, const gho_llint b) {
-  return (b != 0) ? gho_llint_gcd_without_abs(b, a % b) : a;
+  const gho_ullint a_abs = (a < 0) ? -(gho_ullint)a : (gho_ullint)a;
+  const gho_ullint b_abs = (b < 0) ? -(gho_ullint)b : (gho_ullint)b;
+  return (gho_llint)gho_ullint_gcd(a_abs, b_abs);
 }
 
 #ifdef gho_with_gmp
@@ -119,7 +137,7 @@ gho_llint gho_llint_gcd(const gho_llint a, const gho_llint b) {
  */
 gho_mpz_t gho_mpz_gcd(const gho_mpz_t a, const gho_mpz_t b) {
   gho_mpz_t r = gho_mpz_create();
-  mpz_mod(r.i, a.i, b.i);
+  mpz_gcd(r.i, a.i, b.i);
   return r;
 }
 #endif
@@ -133,15 +151,195 @@ gho_mpz_t gho_mpz_gcd(const gho_mpz_t a, const gho_mpz_t b) {
  * @relates gho_mpz_t
  */
 gho_ulint gho_mpz_gcd_uli(const gho_mpz_t a, const gho_ulint b) {
+  // mpz_gcd_ui returns the gcd when it fits in a gho_ulint (b != 0)
+  if (b != 0) { return mpz_gcd_ui(NULL, a.i, b); }
   gho_mpz_t tmp = gho_mpz_create();
-  gho_ulint r = mpz_mod_ui(tmp.i, a.i, b);
+  mpz_gcd_ui(tmp.i, a.i, b);
+  const gho_ulint r = mpz_get_ui(tmp.i);
   gho_mpz_destroy(&tmp);
   return r;
 }
 #endif
 
+// lcm
+
+/**
+ * @brief Least common multiple of int
+ * @param[in] a A int
+ * @param[in] b A int
+ * @return Least common multiple of int (>= 0, 0 if a == 0 or b == 0)
+ * @relates gho_int
+ */
+int gho_int_lcm(const int a, const int b) {
+  return (int)gho_llint_lcm(a, b);
+}
+
+/**
+ * @brief Least common multiple of gho_lint
+ * @param[in] a A gho_lint
+ * @param[in] b A gho_lint
+ * @return Least common multiple of gho_lint (>= 0, 0 if a == 0 or b == 0)
+ * @relates gho_lint
+ */
+gho_lint gho_lint_lcm(const gho_lint a, const gho_lint b) {
+  return (gho_lint)gho_llint_lcm(a, b);
+}
+
+/**
+ * @brief Least common multiple of gho_llint
+ * @param[in] a A gho_llint
+ * @param[in] b A gho_llint
+ * @return Least common multiple of gho_llint (>= 0, 0 if a == 0 or b == 0),
+ *         modulo 2^n if it does not fit
+ * @relates gho_llint
+ */
+gho_llint gho_llint_lcm(const gho_llint a, const gho_llint b) {
+  if (a == 0 || b == 0) { return 0; }
+  const gho_ullint a_abs = (a < 0) ? -(gho_ullint)a : (gho_ullint)a;
+  const gho_ullint b_abs = (b < 0) ? -(gho_ullint)b : (gho_ullint)b;
+  return (gho_llint)(a_abs / gho_ullint_gcd(a_abs, b_abs) * b_abs);
+}
+
+// is_divisible
+
+// gho_*_is_divisible(a, b) return true when b divides a, with the convention
+// of GMP: only 0 is divisible by 0
+
+/**
+ * @brief Return true if a is divisible by b
+ * @param[in] a A gho_ullint
+ * @param[in] b A gho_ullint
+ * @return true if a is divisible by b (a == 0 if b == 0)
+ * @relates gho_ullint
+ */
+bool gho_ullint_is_divisible(const gho_ullint a, const gho_ullint b) {
+  if (b == 0) { return a == 0; }
+  return a % b == 0;
+}
+
+/**
+ * @brief Return true if a is divisible by b
+ * @param[in] a A int
+ * @param[in] b A int
+ * @return true if a is divisible by b (a == 0 if b == 0)
+ * @relates gho_int
+ */
+bool gho_int_is_divisible(const int a, const int b) {
+  return gho_llint_is_divisible(a, b);
+}
+
+/**
+ * @brief Return true if a is divisible by b
+ * @param[in] a A gho_lint
+ * @param[in] b A gho_lint
+ * @return true if a is divisible by b (a == 0 if b == 0)
+ * @relates gho_lint
+ */
+bool gho_lint_is_divisible(const gho_lint a, const gho_lint b) {
+  return gho_llint_is_divisible(a, b);
+}
+
+/**
+ * @brief Return true if a is divisible by b
+ * @param[in] a A gho_llint
+ * @param[in] b A gho_llint
+ * @return true if a is divisible by b (a == 0 if b == 0)
+ * @relates gho_llint
+ */
+bool gho_llint_is_divisible(const gho_llint a, const gho_llint b) {
+  // The absolute values avoid LLONG_MIN % -1
+  const gho_ullint a_abs = (a < 0) ? -(gho_ullint)a : (gho_ullint)a;
+  const gho_ullint b_abs = (b < 0) ? -(gho_ullint)b : (gho_ullint)b;
+  return gho_ullint_is_divisible(a_abs, b_abs);
+}
+
+/**
+ * @brief Return the inverse of d modulo 2^64
+ * @param[in] d A gho_ullint (odd)
+ * @return the inverse of d modulo 2^64 (d * inverse == 1 modulo 2^64)
+ * @note With d = d_odd * 2^k, a is divisible by d if and only if
+ *       rotate_right(a * inverse(d_odd), k) <= ULLONG_MAX / d, this replaces
+ *       a division by a multiplication when d is used several times
+ *       (Hacker's Delight, 10-16)
+ * @warning Do not use this function, it is used by the vector divisibility
+ *          tests
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_inverse_(const gho_ullint d) {
+  // d * d == 1 modulo 8, each Newton iteration doubles the number of bits
+  gho_ullint x = d;
+  for (int i = 0; i < 5; ++i) { x *= 2 - d * x; }
+  return x;
+}
+
 // log
 
+// gho_*_log2 and gho_*_log10 return the number of digits of |i| in base 2 and
+// in base 10 (1 for 0): log2 is the index of the highest bit (count leading
+// zeros), log10 is approximated from log2 and corrected with a table of the
+// powers of 10
+// http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+
+/**
+ * @brief Return the number of leading zeros of i
+ * @param[in] i A gho_ullint (i != 0)
+ * @return the number of leading zeros of i
+ * @warning Do not use this function, it is used by the log functions
+ * @relates gho_ullint
+ */
+int gho_ullint_clz_(const gho_ullint i) {
+  #if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(i);
+  #else
+    int n = 0;
+    gho_ullint v = i;
+    while ((v & ((gho_ullint)1 << 63)) == 0) { v <<= 1; ++n; }
+    return n;
+  #endif
+}
+
+/**
+ * @brief Return 10 ^ n
+ * @param[in] n An int in [0, 19]
+ * @return 10 ^ n
+ * @warning Do not use this function, it is used by the log and pow_10
+ *          functions
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_pow_10_(const int n) {
+  static const gho_ullint pow_10[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+    10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+    100000000000ull, 1000000000000ull, 10000000000000ull,
+    100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+  };
+  return pow_10[n];
+}
+
+/**
+ * @brief Return log2(i)
+ * @param[in] i A gho_ullint
+ * @return log2(i) (number of digits in base 2, 1 for 0)
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_log2(const gho_ullint i) {
+  return (i == 0) ? 1 : (gho_ullint)(64 - gho_ullint_clz_(i));
+}
+
+/**
+ * @brief Return log10(i)
+ * @param[in] i A gho_ullint
+ * @return log10(i) (number of digits in base 10, 1 for 0)
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_log10(const gho_ullint i) {
+  if (i == 0) { return 1; }
+  // 1233 / 4096 ~ log10(2)
+  const int t = (int)((gho_ullint_log2(i) * 1233) >> 12);
+  return (gho_ullint)t + 1 - (i < gho_ullint_pow_10_(t));
+}
+
 /**
  * @brief Return log2(i)
  * @param[in] i A int
@@ -149,11 +347,7 @@ gho_ulint gho_mpz_gcd_uli(const gho_mpz_t a, const gho_ulint b) {
  * @relates gho_int
  */
 int gho_int_log2(const int i) {
-  int n = 0;
-  int v = gho_T_abs(i);
-  while (v) { v >>= 1; ++n; }
-  n = ((n == 0) ? 1 : n);
-  return n;
+  return (int)gho_llint_log2(i);
 }
 
 /**
@@ -163,11 +357,7 @@ int gho_int_log2(const int i) {
  * @relates gho_int
  */
 int gho_int_log10(const int i) {
-  int n = 0;
-  int v = gho_T_abs(i);
-  while (v) { v /= 10; ++n; }
-  n = ((n == 0) ? 1 : n);
-  return n;
+  return (int)gho_llint_log10(i);
 }
 
 /**
@@ -177,11 +367,7 @@ int gho_int_log10(const int i) {
  * @relates gho_lint
  */
 gho_lint gho_lint_log2(const gho_lint i) {
-  gho_lint n = 0;
-  gho_lint v = gho_T_abs(i);
-  while (v) { v >>= 1; ++n; }
-  n = ((n == 0) ? 1 : n);
-  return n;
+  return (gho_lint)gho_llint_log2(i);
 }
 
 /**
@@ -191,11 +377,7 @@ gho_lint gho_lint_log2(const gho_lint i) {
  * @relates gho_lint
  */
 gho_lint gho_lint_log10(const gho_lint i) {
-  gho_lint n = 0;
-  gho_lint v = gho_T_abs(i);
-  while (v) { v /= 10; ++n; }
-  n = ((n == 0) ? 1 : n);
-  return n;
+  return (gho_lint)gho_llint_log10(i);
 }
 
 /**
@@ -205,11 +387,7 @@ gho_lint gho_lint_log10(const gho_lint i) {
  * @relates gho_llint
  */
 gho_llint gho_llint_log2(const gho_llint i) {
-  gho_llint n = 0;
-  gho_llint v = gho_T_abs(i);
-  while (v) { v >>= 1; ++n; }
-  n = ((n == 0) ? 1 : n);
-  return n;
+  return (gho_llint)gho_ullint_log2((i < 0) ? -(gho_ullint)i : (gho_ullint)i);
 }
 
 /**
@@ -219,11 +397,7 @@ gho_llint gho_llint_log2(const gho_llint i) {
  * @relates gho_llint
  */
 gho_llint gho_llint_log10(const gho_llint i) {
-  gho_llint n = 0;
-  gho_llint v = gho_T_abs(i);
-  while (v) { v /= 10; ++n; }
-  n = ((n == 0) ? 1 : n);
-  return n;
+  return (gho_llint)gho_ullint_log10((i < 0) ? -(gho_ullint)i : (gho_ullint)i);
 }
 
 #ifdef gho_with_gmp
@@ -235,21 +409,7 @@ gho_llint gho_llint_log10(const gho_llint i) {
  */
 gho_mpz_t gho_mpz_log2(const gho_mpz_t i) {
   gho_mpz_t n = gho_mpz_create();
-  gho_mpz_t v = gho_mpz_abs(i);
-  while (gho_mpz_equal_li(&v, 0) == false) {
-    // v /= 2;
-    {
-      gho_mpz_t tmp = gho_mpz_floor_div_li(v, 2);
-      gho_T_swap(gho_mpz_t, v, tmp)
-      gho_mpz_destroy(&tmp);
-    }
-    // ++n;
-    gho_mpz_add_li(n, 1);
-  }
-  // n = ((n == 0) ? 1 : n);
-  if (gho_mpz_equal_li(&n, 1)) { gho_mpz_set_li(&n, 1); }
-  // Destroy and return
-  gho_mpz_destroy(&v);
+  mpz_set_ui(n.i, (gho_ulint)mpz_sizeinbase(i.i, 2));
   return n;
 }
 #endif
@@ -263,21 +423,188 @@ gho_mpz_t gho_mpz_log2(const gho_mpz_t i) {
  */
 gho_mpz_t gho_mpz_log10(const gho_mpz_t i) {
   gho_mpz_t n = gho_mpz_create();
-  gho_mpz_t v = gho_mpz_abs(i);
-  while (gho_mpz_equal_li(&v, 0) == false) {
-    // v /= 10;
-    {
-      gho_mpz_t tmp = gho_mpz_floor_div_li(v, 10);
-      gho_T_swap(gho_mpz_t, v, tmp);
-      gho_mpz_destroy(&tmp);
-    }
-    // ++n;
-    gho_mpz_add_li(n, 1);
-  }
-  // n = ((n == 0) ? 1 : n);
-  if (gho_mpz_equal_li(&n, 1)) { gho_mpz_set_li(&n, 1); }
-  // Destroy and return
-  gho_mpz_destroy(&v);
+  mpz_set_ui(n.i, (gho_ulint)gho_mpz_log10_(i.i));
   return n;
 }
 #endif
+
+#ifdef gho_with_gmp
+/**
+ * @brief Return log10(i)
+ * @param[in] i A mpz_t
+ * @return log10(i) (number of digits in base 10, 1 for 0)
+ * @warning Do not use this function, use gho_mpz_log10
+ * @relates gho_mpz_t
+ */
+size_t gho_mpz_log10_(const mpz_t i) {
+  // |i| fits in a gho_ulint: table
+  if (mpz_cmpabs_ui(i, ULONG_MAX) <= 0) {
+    return (size_t)gho_ullint_log10(mpz_get_ui(i));
+  }
+  // mpz_sizeinbase is exact or 1 too big in base 10
+  const size_t n = mpz_sizeinbase(i, 10);
+  mpz_t p;
+  mpz_init(p);
+  mpz_ui_pow_ui(p, 10, (gho_ulint)(n - 1));
+  const size_t r = (mpz_cmpabs(i, p) < 0) ? n - 1 : n;
+  mpz_clear(p);
+  return r;
+}
+#endif
+
+// pow_10
+
+/**
+ * @brief Return the greatest power of 10 <= i
+ * @param[in] i A gho_ullint
+ * @return the greatest power of 10 <= i, 0 for 0
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_pow_10_floor(const gho_ullint i) {
+  if (i == 0) { return 0; }
+  return gho_ullint_pow_10_((int)gho_ullint_log10(i) - 1);
+}
+
+/**
+ * @brief Return the power of 10 nearest to i
+ * @param[in] i A gho_ullint
+ * @return the power of 10 nearest to i (the greatest if there are two), 0 for 0
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_pow_10_round(const gho_ullint i) {
+  if (i == 0) { return 0; }
+  const int n = (int)gho_ullint_log10(i);
+  const gho_ullint floor = gho_ullint_pow_10_(n - 1);
+  // 10 ^ n does not fit for n == 20 but i < 5.5 * 10 ^ 19 is then true
+  if (n == 20) { return floor; }
+  const gho_ullint ceil = gho_ullint_pow_10_(n);
+  return (i - floor < ceil - i) ? floor : ceil;
+}
+
+// pow
+
+// Exponentiation by squaring: O(log(e)) multiplications
+// http://en.wikipedia.org/wiki/Exponentiation_by_squaring
+
+/**
+ * @brief Return a ^ e (modulo 2^n if it does not fit, see gho_int_pow_overflow
+ *        to detect the overflow)
+ * @param[in] a A int
+ * @param[in] e A gho_ullint
+ * @return a ^ e
+ * @relates gho_int
+ */
+int gho_int_pow(const int a, const gho_ullint e) {
+  return (int)gho_llint_pow(a, e);
+}
+
+/**
+ * @brief Return a ^ e (modulo 2^n if it does not fit, see
+ *        gho_lint_pow_overflow to detect the overflow)
+ * @param[in] a A gho_lint
+ * @param[in] e A gho_ullint
+ * @return a ^ e
+ * @relates gho_lint
+ */
+gho_lint gho_lint_pow(const gho_lint a, const gho_ullint e) {
+  return (gho_lint)gho_llint_pow(a, e);
+}
+
+/**
+ * @brief Return a ^ e (modulo 2^n if it does not fit, see
+ *        gho_llint_pow_overflow to detect the overflow)
+ * @param[in] a A gho_llint
+ * @param[in] e A gho_ullint
+ * @return a ^ e
+ * @relates gho_llint
+ */
+gho_llint gho_llint_pow(const gho_llint a, const gho_ullint e) {
+  gho_ullint r = 1;
+  gho_ullint base = (gho_ullint)a;
+  for (gho_ullint n = e; n != 0; n >>= 1) {
+    if (n & 1) { r *= base; }
+    base *= base;
+  }
+  return (gho_llint)r;
+}
+
+/**
+ * @brief Return a ^ e modulo m
+ * @param[in] a A int
+ * @param[in] e A gho_ullint
+ * @param[in] m A int (m != 0)
+ * @return a ^ e modulo m, in [0, |m|)
+ * @relates gho_int
+ */
+int gho_int_pow_mod(const int a, const gho_ullint e, const int m) {
+  return (int)gho_llint_pow_mod(a, e, m);
+}
+
+/**
+ * @brief Return a ^ e modulo m
+ * @param[in] a A gho_lint
+ * @param[in] e A gho_ullint
+ * @param[in] m A gho_lint (m != 0)
+ * @return a ^ e modulo m, in [0, |m|)
+ * @relates gho_lint
+ */
+gho_lint gho_lint_pow_mod(const gho_lint a, const gho_ullint e,
+                          const gho_lint m) {
+  return (gho_lint)gho_llint_pow_mod(a, e, m);
+}
+
+/**
+ * @brief Return a ^ e modulo m
+ * @param[in] a A gho_llint
+ * @param[in] e A gho_ullint
+ * @param[in] m A gho_llint (m != 0)
+ * @return a ^ e modulo m, in [0, |m|)
+ * @relates gho_llint
+ */
+gho_llint gho_llint_pow_mod(const gho_llint a, const gho_ullint e,
+                            const gho_llint m) {
+  #ifndef NDEBUG
+  if (m == 0) {
+    fprintf(stderr, "ERROR: gho_llint_pow_mod(a, e, m): m can not be equal "
+                    "to 0!\n");
+    exit(1);
+  }
+  #endif
+  const gho_ullint m_abs = (m < 0) ? -(gho_ullint)m : (gho_ullint)m;
+  // base = a mod |m|, in [0, |m|)
+  gho_ullint base = ((a < 0) ? -(gho_ullint)a : (gho_ullint)a) % m_abs;
+  if (a < 0 && base != 0) { base = m_abs - base; }
+  gho_ullint r = 1 % m_abs;
+  for (gho_ullint n = e; n != 0; n >>= 1) {
+    if (n & 1) { r = gho_ullint_mul_mod_(r, base, m_abs); }
+    base = gho_ullint_mul_mod_(base, base, m_abs);
+  }
+  return (gho_llint)r;
+}
+
+/**
+ * @brief Return a * b modulo m without overflow
+ * @param[in] a A gho_ullint (a < m)
+ * @param[in] b A gho_ullint (b < m)
+ * @param[in] m A gho_ullint (m != 0)
+ * @return a * b modulo m
+ * @warning Do not use this function, it is used by gho_*_pow_mod
+ * @relates gho_ullint
+ */
+gho_ullint gho_ullint_mul_mod_(const gho_ullint a, const gho_ullint b,
+                               const gho_ullint m) {
+  // The product fits in a gho_ullint
+  if (m <= 0xFFFFFFFFull) { return (a * b) % m; }
+  #ifdef __SIZEOF_INT128__
+    return (gho_ullint)(((gho_uint128_t_)a * b) % m);
+  #else
+    // Double and add, a + a and r + a can not overflow in the comparisons
+    gho_ullint r = 0;
+    gho_ullint x = a;
+    for (gho_ullint n = b; n != 0; n >>= 1) {
+      if (n & 1) { r = (r >= m - x) ? r - (m - x) : r + x; }
+      x = (x >= m - x) ? x - (m - x) : x + x;
+    }
+    return r;
+  #endif
+}
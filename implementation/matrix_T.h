@@ -12,9 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string.h>
+
 #include "../memory.h"
 #include "../c_str.h"
 #include "../output.h"
+#include "../math_T.h"
 #include "../int/size_t.h"
 
 
@@ -30,7 +33,10 @@ gho_matrix_T_t gho_matrix_T_create() {
   matrix.type = gho_type_matrix_T;
   matrix.nb_row = 0u;
   matrix.nb_col = 0u;
-  matrix.array = gho_array_alloc(T_t*, matrix.nb_row);
+  matrix.nb_row_capacity = 0u;
+  matrix.nb_col_capacity = 0u;
+  matrix.data = NULL;
+  matrix.array = NULL;
   return matrix;
 }
 
@@ -43,16 +49,15 @@ gho_matrix_T_t gho_matrix_T_create() {
  */
 gho_matrix_T_t gho_matrix_T_create_n_m(const size_t nb_row,
                                        const size_t nb_col) {
-  gho_matrix_T_t matrix;
-  matrix.type = gho_type_matrix_T;
+  gho_matrix_T_t matrix = gho_matrix_T_create();
+  gho_matrix_T_reserve(&matrix, nb_row, nb_col);
   matrix.nb_row = nb_row;
   matrix.nb_col = nb_col;
-  matrix.array = gho_array_alloc(T_t*, matrix.nb_row);
   
   for (size_t i = 0; i < matrix.nb_row; ++i) {
-    matrix.array[i] = gho_array_alloc(T_t, matrix.nb_col);
+    T_t* row = matrix.array[i];
     for (size_t j = 0; j < matrix.nb_col; ++j) {
-      matrix.array[i][j] = gho_T_create();
+      row[j] = gho_T_create();
     }
   }
   return matrix;
@@ -69,21 +74,51 @@ gho_matrix_T_t gho_matrix_T_create_n_m(const size_t nb_row,
 gho_matrix_T_t gho_matrix_T_create_n_m_copy(
                                        const size_t nb_row, const size_t nb_col,
                                        const T_t* const default_value) {
-  gho_matrix_T_t matrix;
-  matrix.type = gho_type_matrix_T;
+  gho_matrix_T_t matrix = gho_matrix_T_create();
+  gho_matrix_T_reserve(&matrix, nb_row, nb_col);
   matrix.nb_row = nb_row;
   matrix.nb_col = nb_col;
-  matrix.array = gho_array_alloc(T_t*, matrix.nb_row);
   
   for (size_t i = 0; i < matrix.nb_row; ++i) {
-    matrix.array[i] = gho_array_alloc(T_t, matrix.nb_col);
+    T_t* row = matrix.array[i];
     for (size_t j = 0; j < matrix.nb_col; ++j) {
-      matrix.array[i][j] = gho_T_copy(default_value);
+      row[j] = gho_T_copy(default_value);
     }
   }
   return matrix;
 }
 
+#ifdef gho_T_mpz
+/**
+ * \brief Return a new gho_matrix_T (0) whose limbs are in a gho_gmp_pool_t
+ * \param[in] nb_row  Number of rows
+ * \param[in] nb_col  Number of columns
+ * \param[in] pool    A gho_gmp_pool_t
+ * \param[in] nb_limb Number of limbs reserved in the pool for each element
+ * \return a new gho_matrix_T
+ * \warning gho_gmp_memory_functions_install has to be called before and the
+ *          pool has to be destroyed after the matrix
+ * @relates gho_matrix_T_t
+ */
+gho_matrix_T_t gho_matrix_T_create_n_m_in_pool(
+                                       const size_t nb_row, const size_t nb_col,
+                                       gho_gmp_pool_t* pool,
+                                       const size_t nb_limb) {
+  gho_matrix_T_t matrix = gho_matrix_T_create();
+  gho_matrix_T_reserve(&matrix, nb_row, nb_col);
+  matrix.nb_row = nb_row;
+  matrix.nb_col = nb_col;
+  
+  for (size_t i = 0; i < matrix.nb_row; ++i) {
+    T_t* row = matrix.array[i];
+    for (size_t j = 0; j < matrix.nb_col; ++j) {
+      gho_gmp_pool_mpz_init(pool, row[j].i, nb_limb);
+    }
+  }
+  return matrix;
+}
+#endif
+
 /**
  * \brief Destroy a gho_matrix_T
  * \param[in] matrix A gho_matrix_T
@@ -91,15 +126,18 @@ gho_matrix_T_t gho_matrix_T_create_n_m_copy(
  */
 void gho_matrix_T_destroy(gho_matrix_T_t* matrix) {
   for (size_t i = 0; i < matrix->nb_row; ++i) {
+    T_t* row = matrix->array[i];
     for (size_t j = 0; j < matrix->nb_col; ++j) {
-      gho_T_destroy(&matrix->array[i][j]);
+      gho_T_destroy(&row[j]);
     }
-    free(matrix->array[i]); matrix->array[i] = NULL;
   }
   
   matrix->nb_row = 0u;
   matrix->nb_col = 0u;
-  free(matrix->array); matrix->array = NULL;
+  matrix->nb_row_capacity = 0u;
+  matrix->nb_col_capacity = 0u;
+  gho_free(matrix->data); matrix->data = NULL;
+  gho_free(matrix->array); matrix->array = NULL;
 }
 
 /**
@@ -128,8 +166,9 @@ void gho_matrix_T_fprinti(FILE* file, const gho_matrix_T_t* const matrix,
   for (size_t i = 0; i < matrix->nb_row; ++i) {
     gho_fprinti(file, indent);
     fprintf(file, "  { ");
+    const T_t* const row = gho_matrix_T_row(matrix, i);
     for (size_t j = 0; j < matrix->nb_col; ++j) {
-      gho_T_fprint(file, &matrix->array[i][j]);
+      gho_T_fprint(file, &row[j]);
       if (j != matrix->nb_col - 1) { fprintf(file, ","); }
       fprintf(file, " ");
     }
@@ -168,22 +207,32 @@ void gho_matrix_T_print(const gho_matrix_T_t* const matrix) {
  */
 void gho_matrix_T_sprinti(char** c_str, const gho_matrix_T_t* const matrix,
                           const unsigned int indent) {
-  gho_sprinti(c_str, indent);
-  gho_c_str_add(c_str, "{\n");
+  // The matrix is built in a gho_string_t (amortized append) and each element
+  // in a small C string, then the result is added in c_str in one go
+  gho_string_t r = gho_string_create();
+  char* element = gho_c_str_create();
+  gho_string_add_char_n(&r, ' ', indent);
+  gho_string_add_c_str_n(&r, "{\n", 2);
   for (size_t i = 0; i < matrix->nb_row; ++i) {
-    gho_sprinti(c_str, indent);
-    gho_c_str_add(c_str, "  { ");
+    gho_string_add_char_n(&r, ' ', indent);
+    gho_string_add_c_str_n(&r, "  { ", 4);
+    const T_t* const row = gho_matrix_T_row(matrix, i);
     for (size_t j = 0; j < matrix->nb_col; ++j) {
-      gho_T_sprint(c_str, &matrix->array[i][j]);
-      if (j != matrix->nb_col - 1) { gho_c_str_add(c_str, ","); }
-      gho_c_str_add(c_str, " ");
+      element[0] = '\0';
+      gho_T_sprint(&element, &row[j]);
+      gho_string_add_c_str(&r, element);
+      if (j != matrix->nb_col - 1) { gho_string_add_char(&r, ','); }
+      gho_string_add_char(&r, ' ');
     }
-    gho_c_str_add(c_str, "}");
-    if (i != matrix->nb_row - 1) { gho_c_str_add(c_str, ","); }
-    gho_c_str_add(c_str, "\n");
+    gho_string_add_char(&r, '}');
+    if (i != matrix->nb_row - 1) { gho_string_add_char(&r, ','); }
+    gho_string_add_char(&r, '\n');
   }
-  gho_sprinti(c_str, indent);
-  gho_c_str_add(c_str, "}");
+  gho_string_add_char_n(&r, ' ', indent);
+  gho_string_add_char(&r, '}');
+  gho_c_str_add_n(c_str, r.c_str, r.size);
+  gho_c_str_destroy(&element);
+  gho_string_destroy(&r);
 }
 
 /**
@@ -196,6 +245,92 @@ void gho_matrix_T_sprint(char** c_str, const gho_matrix_T_t* const matrix) {
   gho_matrix_T_sprinti(c_str, matrix, 0);
 }
 
+#ifdef gho_T_fwrite_bin
+/**
+ * \brief Write a gho_matrix_T in a file with the binary format
+ * \param[in] file   A C file
+ * \param[in] matrix A gho_matrix_T
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_fwrite_bin(FILE* file, const gho_matrix_T_t* const matrix) {
+  #ifdef gho_T_bin_block
+    gho_binary_fwrite_header(file, matrix->type, sizeof(T_t));
+  #else
+    gho_binary_fwrite_header(file, matrix->type, 0);
+  #endif
+  gho_binary_fwrite_size(file, matrix->nb_row);
+  gho_binary_fwrite_size(file, matrix->nb_col);
+  #ifdef gho_T_bin_block
+    // Without padding between the rows, the matrix is written in one block
+    if (matrix->nb_col == matrix->nb_col_capacity) {
+      gho_binary_fwrite_block(file, matrix->data, sizeof(T_t),
+                              matrix->nb_row * matrix->nb_col);
+      return;
+    }
+  #endif
+  for (size_t i = 0; i < matrix->nb_row; ++i) {
+    const T_t* const row = gho_matrix_T_row(matrix, i);
+    #ifdef gho_T_bin_block
+      gho_binary_fwrite_block(file, row, sizeof(T_t), matrix->nb_col);
+    #else
+      for (size_t j = 0; j < matrix->nb_col; ++j) {
+        gho_T_fwrite_bin(file, &row[j]);
+      }
+    #endif
+  }
+}
+#endif
+
+// Input
+
+#ifdef gho_T_fread_bin
+/**
+ * \brief Read a gho_matrix_T from a file with the binary format
+ * \param[in] file A C file
+ * \return the gho_matrix_T read
+ * @relates gho_matrix_T_t
+ */
+gho_matrix_T_t gho_matrix_T_fread_bin(FILE* file) {
+  gho_matrix_T_t r;
+  gho_matrix_T_fread_bin_(file, &r);
+  return r;
+}
+
+/**
+ * \brief Read a gho_matrix_T from a file with the binary format
+ * \param[in] file   A C file
+ * \param[in] matrix A pointer on an not initialized gho_matrix_T
+ * \warning Do not use this function, use gho_matrix_T_fread_bin
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_fread_bin_(FILE* file, gho_matrix_T_t* matrix) {
+  *matrix = gho_matrix_T_create();
+  #ifdef gho_T_bin_block
+    gho_binary_fread_header(file, matrix->type, sizeof(T_t));
+  #else
+    gho_binary_fread_header(file, matrix->type, 0);
+  #endif
+  const size_t nb_row = gho_binary_fread_size(file);
+  const size_t nb_col = gho_binary_fread_size(file);
+  gho_matrix_T_reserve(matrix, nb_row, nb_col);
+  #ifdef gho_T_bin_block
+    // The matrix is new: nb_col_capacity == nb_col, one block is read
+    gho_binary_fread_block(file, matrix->data, sizeof(T_t), nb_row * nb_col);
+    matrix->nb_row = nb_row;
+    matrix->nb_col = nb_col;
+  #else
+    matrix->nb_col = nb_col;
+    for (size_t i = 0; i < nb_row; ++i) {
+      T_t* row = matrix->array[i];
+      for (size_t j = 0; j < nb_col; ++j) {
+        row[j] = gho_T_fread_bin(file);
+      }
+      ++matrix->nb_row;
+    }
+  #endif
+}
+#endif
+
 // Copy & comparisons
 
 /**
@@ -219,14 +354,45 @@ gho_matrix_T_t gho_matrix_T_copy(const gho_matrix_T_t* const matrix) {
  */
 void gho_matrix_T_copy_(const gho_matrix_T_t* const matrix,
                         gho_matrix_T_t* copy) {
-  *copy = gho_matrix_T_create_n_m(matrix->nb_row, matrix->nb_col);
+  *copy = gho_matrix_T_create();
+  gho_matrix_T_reserve(copy, matrix->nb_row, matrix->nb_col);
+  copy->nb_row = matrix->nb_row;
+  copy->nb_col = matrix->nb_col;
+  for (size_t i = 0; i < matrix->nb_row; ++i) {
+    const T_t* const row = gho_matrix_T_row(matrix, i);
+    T_t* row_copy = copy->array[i];
+    for (size_t j = 0; j < matrix->nb_col; ++j) {
+      row_copy[j] = gho_T_copy(&row[j]);
+    }
+  }
+}
+
+#ifdef gho_T_mpz
+/**
+ * \brief Copy a gho_matrix_T, the limbs of the copy are in a gho_gmp_pool_t
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] pool   A gho_gmp_pool_t
+ * \return the gho_matrix_T copied
+ * \warning gho_gmp_memory_functions_install has to be called before and the
+ *          pool has to be destroyed after the copy
+ * @relates gho_matrix_T_t
+ */
+gho_matrix_T_t gho_matrix_T_copy_in_pool(const gho_matrix_T_t* const matrix,
+                                         gho_gmp_pool_t* pool) {
+  gho_matrix_T_t copy = gho_matrix_T_create();
+  gho_matrix_T_reserve(&copy, matrix->nb_row, matrix->nb_col);
+  copy.nb_row = matrix->nb_row;
+  copy.nb_col = matrix->nb_col;
   for (size_t i = 0; i < matrix->nb_row; ++i) {
+    const T_t* const row = gho_matrix_T_row(matrix, i);
+    T_t* row_copy = copy.array[i];
     for (size_t j = 0; j < matrix->nb_col; ++j) {
-      gho_T_destroy(&copy->array[i][j]);
-      copy->array[i][j] = gho_T_copy(&matrix->array[i][j]);
+      gho_gmp_pool_mpz_init_set(pool, row_copy[j].i, row[j].i);
     }
   }
+  return copy;
 }
+#endif
 
 /**
  * \brief Equality between two gho_matrix_T
@@ -239,8 +405,10 @@ bool gho_matrix_T_equal(const gho_matrix_T_t* const a,
                         const gho_matrix_T_t* const b) {
   if (a->nb_row != b->nb_row || a->nb_col != b->nb_col) { return false; }
   for (size_t i = 0; i < a->nb_row; ++i) {
+    const T_t* const row_a = gho_matrix_T_row(a, i);
+    const T_t* const row_b = gho_matrix_T_row(b, i);
     for (size_t j = 0; j < a->nb_col; ++j) {
-      if (gho_T_equal(&a->array[i][j], &b->array[i][j]) == false) { return false; }
+      if (gho_T_equal(&row_a[j], &row_b[j]) == false) { return false; }
     }
   }
   return true;
@@ -256,27 +424,33 @@ bool gho_matrix_T_equal(const gho_matrix_T_t* const a,
  */
 gho_string_t gho_matrix_T_to_string(const gho_matrix_T_t* const matrix) {
   gho_string_t r = gho_string_create();
-  gho_matrix_T_sprint(&r.c_str, matrix);
+  char* c_str = gho_c_str_create();
+  gho_matrix_T_sprint(&c_str, matrix);
+  gho_string_absorb_c_str(&r, &c_str);
   return r;
 }
 
 /**
  * \brief Convert a gho_matrix_T into a gho_any
  * \param[in] matrix A gho_matrix_T
- * \return the gho_any from the gho_matrix_T
+ * \return the gho_any from the gho_matrix_T (without binary format, use
+ *         gho_matrix_T_fwrite_bin on the gho_matrix_T)
  * @relates gho_matrix_T_t
  */
 gho_any_t gho_matrix_T_to_any(const gho_matrix_T_t* const matrix) {
-  gho_any_t r = gho_any_create();
-  r.size_of_struct = sizeof(gho_matrix_T_t);
-  gho_matrix_T_t* p = gho_alloc(gho_matrix_T_t); gho_matrix_T_copy_(matrix, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_matrix_T_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_matrix_T_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_matrix_T_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_matrix_T_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_matrix_T_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_matrix_T_to_string;
+  static const gho_any_vtable_t vtable = {
+    gho_type_matrix_T, sizeof(gho_matrix_T_t),
+    (gho_destroy_fct_t)gho_matrix_T_destroy,
+    (gho_fprinti_fct_t)gho_matrix_T_fprinti,
+    (gho_sprinti_fct_t)gho_matrix_T_sprinti,
+    (gho_copy_fct_t)gho_matrix_T_copy_,
+    (gho_equal_fct_t)gho_matrix_T_equal,
+    (gho_to_string_fct_t)gho_matrix_T_to_string,
+    // gho_any_fread_bin can not read a matrix: gho_any_fwrite_bin refuses it
+    NULL
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_matrix_T_copy_(matrix, (gho_matrix_T_t*)gho_any_data(&r));
   return r;
 }
 
@@ -302,6 +476,27 @@ size_t gho_matrix_T_nb_col(const gho_matrix_T_t* const matrix) {
   return matrix->nb_col;
 }
 
+/**
+ * \brief Return the number of rows allocated of a gho_matrix_T
+ * \param[in] matrix A gho_matrix_T
+ * \return the number of rows allocated
+ * @relates gho_matrix_T_t
+ */
+size_t gho_matrix_T_nb_row_capacity(const gho_matrix_T_t* const matrix) {
+  return matrix->nb_row_capacity;
+}
+
+/**
+ * \brief Return the number of columns allocated of a gho_matrix_T
+ *        (the stride between two rows)
+ * \param[in] matrix A gho_matrix_T
+ * \return the number of columns allocated
+ * @relates gho_matrix_T_t
+ */
+size_t gho_matrix_T_nb_col_capacity(const gho_matrix_T_t* const matrix) {
+  return matrix->nb_col_capacity;
+}
+
 /**
  * \brief Return true if the gho_matrix_T is empty, false otherwise
  * \param[in] matrix A gho_matrix_T
@@ -312,6 +507,53 @@ bool gho_matrix_T_empty(const gho_matrix_T_t* const matrix) {
   return (matrix->nb_row == 0 || matrix->nb_col == 0);
 }
 
+/**
+ * \brief Update the capacities of a gho_matrix_T
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] nb_row Number of rows
+ * \param[in] nb_col Number of columns
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_reserve(gho_matrix_T_t* matrix,
+                          const size_t nb_row, const size_t nb_col) {
+  if (nb_row <= matrix->nb_row_capacity && nb_col <= matrix->nb_col_capacity) {
+    return;
+  }
+  const size_t nb_row_capacity = gho_T_max(nb_row, matrix->nb_row_capacity);
+  const size_t nb_col_capacity = gho_T_max(nb_col, matrix->nb_col_capacity);
+  // Same stride: the rows stay at the same place
+  if (nb_col_capacity == matrix->nb_col_capacity) {
+    gho_array_realloc(matrix->data, T_t, nb_row_capacity * nb_col_capacity);
+  }
+  // New stride: the rows are moved in a new array
+  else {
+    T_t* data = gho_array_alloc(T_t, nb_row_capacity * nb_col_capacity);
+    for (size_t i = 0; i < matrix->nb_row; ++i) {
+      T_t* row = matrix->data + i * matrix->nb_col_capacity;
+      T_t* row_new = data + i * nb_col_capacity;
+      gho_T_move(row_new, row, matrix->nb_col);
+    }
+    gho_free(matrix->data);
+    matrix->data = data;
+  }
+  matrix->nb_row_capacity = nb_row_capacity;
+  matrix->nb_col_capacity = nb_col_capacity;
+  gho_array_realloc(matrix->array, T_t*, matrix->nb_row_capacity);
+  gho_matrix_T_update_array_(matrix);
+}
+
+/**
+ * \brief Update the array of rows from the data of a gho_matrix_T
+ * \param[in] matrix A gho_matrix_T
+ * \warning Do not use this function, it is used after a reallocation
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_update_array_(gho_matrix_T_t* matrix) {
+  for (size_t i = 0; i < matrix->nb_row_capacity; ++i) {
+    matrix->array[i] = matrix->data + i * matrix->nb_col_capacity;
+  }
+}
+
 // Get & Set
 
 /**
@@ -324,7 +566,7 @@ bool gho_matrix_T_empty(const gho_matrix_T_t* const matrix) {
  */
 const T_t* gho_matrix_T_at(const gho_matrix_T_t* const matrix,
                                   const size_t i, const size_t j) {
-  return &matrix->array[i][j];
+  return &matrix->data[i * matrix->nb_col_capacity + j];
 }
 
 /**
@@ -337,8 +579,21 @@ const T_t* gho_matrix_T_at(const gho_matrix_T_t* const matrix,
  */
 void gho_matrix_T_set(gho_matrix_T_t* matrix, const size_t i, const size_t j,
                       const T_t* const value) {
-  gho_T_destroy(&matrix->array[i][j]);
-  matrix->array[i][j] = gho_T_copy(value);
+  T_t* p = &matrix->data[i * matrix->nb_col_capacity + j];
+  gho_T_destroy(p);
+  *p = gho_T_copy(value);
+}
+
+/**
+ * \brief Return the row i (without copy)
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] i      Index of the row
+ * \return the row i, an array of nb_col elements
+ * @relates gho_matrix_T_t
+ */
+const T_t* gho_matrix_T_row(const gho_matrix_T_t* const matrix,
+                            const size_t i) {
+  return matrix->data + i * matrix->nb_col_capacity;
 }
 
 // Add & remove
@@ -363,22 +618,20 @@ void gho_matrix_T_add_row_before(gho_matrix_T_t* matrix, const size_t i) {
     fprintf(stderr, "ERROR: gho_matrix_T_add_row_before: invalid row index!\n");
     exit(1);
   }
-  gho_matrix_T_t matrix_new =
-    gho_matrix_T_create_n_m(matrix->nb_row + 1, matrix->nb_col);
-  for (size_t n = 0; n < i; ++n) {
-    for (size_t m = 0; m < matrix->nb_col; ++m) {
-      gho_T_destroy(&matrix_new.array[n][m]);
-      matrix_new.array[n][m] = gho_T_copy(&matrix->array[n][m]);
-    }
+  if (matrix->nb_row == matrix->nb_row_capacity) {
+    gho_matrix_T_reserve(matrix,
+                         gho_growth(matrix->nb_row_capacity, matrix->nb_row + 1),
+                         matrix->nb_col);
   }
-  for (size_t n = i + 1; n < matrix_new.nb_row; ++n) {
-    for (size_t m = 0; m < matrix->nb_col; ++m) {
-      gho_T_destroy(&matrix_new.array[n][m]);
-      matrix_new.array[n][m] = gho_T_copy(&matrix->array[n - 1][m]);
-    }
+  // Move the next rows (the stride does not change)
+  for (size_t k = matrix->nb_row; k > i; --k) {
+    gho_T_move(matrix->array[k], matrix->array[k - 1], matrix->nb_col);
   }
-  gho_matrix_T_destroy(matrix);
-  *matrix = matrix_new;
+  T_t* row = matrix->array[i];
+  for (size_t j = 0; j < matrix->nb_col; ++j) {
+    row[j] = gho_T_create();
+  }
+  ++matrix->nb_row;
 }
 
 /**
@@ -411,20 +664,18 @@ void gho_matrix_T_add_col_before(gho_matrix_T_t* matrix, const size_t j) {
     fprintf(stderr, "ERROR: gho_matrix_T_add_col_before: invalid column index!\n");
     exit(1);
   }
-  gho_matrix_T_t matrix_new =
-    gho_matrix_T_create_n_m(matrix->nb_row, matrix->nb_col + 1);
-  for (size_t n = 0; n < matrix->nb_row; ++n) {
-    for (size_t m = 0; m < j; ++m) {
-      gho_T_destroy(&matrix_new.array[n][m]);
-      matrix_new.array[n][m] = gho_T_copy(&matrix->array[n][m]);
-    }
-    for (size_t m = j + 1; m < matrix_new.nb_col; ++m) {
-      gho_T_destroy(&matrix_new.array[n][m]);
-      matrix_new.array[n][m] = gho_T_copy(&matrix->array[n][m - 1]);
-    }
+  if (matrix->nb_col == matrix->nb_col_capacity) {
+    gho_matrix_T_reserve(matrix,
+                         matrix->nb_row,
+                         gho_growth(matrix->nb_col_capacity, matrix->nb_col + 1));
   }
-  gho_matrix_T_destroy(matrix);
-  *matrix = matrix_new;
+  // Move the next columns in the spare capacity of each row
+  for (size_t i = 0; i < matrix->nb_row; ++i) {
+    T_t* row = matrix->array[i];
+    gho_T_move(row + j + 1, row + j, matrix->nb_col - j);
+    row[j] = gho_T_create();
+  }
+  ++matrix->nb_col;
 }
 
 /**
@@ -458,17 +709,14 @@ void gho_matrix_T_remove_row(gho_matrix_T_t* matrix, const size_t i) {
     exit(1);
   }
   else {
-    for (size_t row = i; row < matrix->nb_row - 1; ++row) {
-      for (size_t col = 0; col < matrix->nb_col; ++col) {
-        gho_T_destroy(&matrix->array[row][col]);
-        matrix->array[row][col] = gho_T_copy(&matrix->array[row + 1][col]);
-      }
+    T_t* row = matrix->array[i];
+    for (size_t j = 0; j < matrix->nb_col; ++j) {
+      gho_T_destroy(&row[j]);
     }
-    for (size_t col = 0; col < matrix->nb_col; ++col) {
-      gho_T_destroy(&matrix->array[matrix->nb_row - 1][col]);
+    // Move the next rows
+    for (size_t k = i + 1; k < matrix->nb_row; ++k) {
+      gho_T_move(matrix->array[k - 1], matrix->array[k], matrix->nb_col);
     }
-    free(matrix->array[matrix->nb_row - 1]);
-    matrix->array[matrix->nb_row - 1] = NULL;
     --matrix->nb_row;
   }
 }
@@ -492,13 +740,215 @@ void gho_matrix_T_remove_col(gho_matrix_T_t* matrix, const size_t j) {
     fprintf(stderr, ")!\n");
   }
   else {
-    for (size_t row = 0; row < matrix->nb_row; ++row) {
-      for (size_t col = j; col < matrix->nb_col - 1; ++col) {
-        gho_T_destroy(&matrix->array[row][col]);
-        matrix->array[row][col] = gho_T_copy(&matrix->array[row][col + 1]);
-      }
-      gho_T_destroy(&matrix->array[row][matrix->nb_col - 1]);
+    for (size_t i = 0; i < matrix->nb_row; ++i) {
+      T_t* row = matrix->array[i];
+      gho_T_destroy(&row[j]);
+      gho_T_move(row + j, row + j + 1, matrix->nb_col - j - 1);
     }
     --matrix->nb_col;
   }
 }
+
+// Row operations
+
+/**
+ * \brief Swap two rows
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] i      Index of a row
+ * \param[in] j      Index of a row
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_swap_rows(gho_matrix_T_t* matrix,
+                            const size_t i, const size_t j) {
+  if (i == j) { return; }
+  T_t* row_i = matrix->array[i];
+  T_t* row_j = matrix->array[j];
+  for (size_t k = 0; k < matrix->nb_col; ++k) {
+    const T_t tmp = row_i[k];
+    row_i[k] = row_j[k];
+    row_j[k] = tmp;
+  }
+}
+
+#if defined(gho_T_integer)
+/**
+ * \brief row_i = a * row_i + b * row_j
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] i      Index of the row modified
+ * \param[in] a      Coefficient of the row i
+ * \param[in] j      Index of a row
+ * \param[in] b      Coefficient of the row j
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_combine_rows(gho_matrix_T_t* matrix,
+                               const size_t i, const T_t* const a,
+                               const size_t j, const T_t* const b) {
+  T_t* row_i = matrix->array[i];
+  const T_t* const row_j = matrix->array[j];
+  const T_t coef_i = *a;
+  const T_t coef_j = *b;
+  const size_t n = matrix->nb_col;
+  for (size_t k = 0; k < n; ++k) {
+    row_i[k] = coef_i * row_i[k] + coef_j * row_j[k];
+  }
+}
+#elif defined(gho_T_mpz)
+/**
+ * \brief row_i = a * row_i + b * row_j
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] i      Index of the row modified
+ * \param[in] a      Coefficient of the row i
+ * \param[in] j      Index of a row
+ * \param[in] b      Coefficient of the row j
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_combine_rows(gho_matrix_T_t* matrix,
+                               const size_t i, const T_t* const a,
+                               const size_t j, const T_t* const b) {
+  T_t* row_i = matrix->array[i];
+  const T_t* const row_j = matrix->array[j];
+  const size_t n = matrix->nb_col;
+  // row_i = (a + b) * row_i
+  if (i == j) {
+    mpz_t coef;
+    mpz_init(coef);
+    mpz_add(coef, a->i, b->i);
+    for (size_t k = 0; k < n; ++k) {
+      mpz_mul(row_i[k].i, row_i[k].i, coef);
+    }
+    mpz_clear(coef);
+  }
+  // In place, without temporary
+  else {
+    const bool a_is_1 = (mpz_cmp_ui(a->i, 1) == 0);
+    for (size_t k = 0; k < n; ++k) {
+      if (a_is_1 == false) { mpz_mul(row_i[k].i, row_i[k].i, a->i); }
+      mpz_addmul(row_i[k].i, row_j[k].i, b->i);
+    }
+  }
+}
+#endif
+
+#if defined(gho_T_integer) && defined(gho_T_gcd)
+/**
+ * \brief Divide a row by the greatest common divisor of its elements
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] i      Index of a row
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_normalize_row(gho_matrix_T_t* matrix, const size_t i) {
+  T_t* row = matrix->array[i];
+  const size_t n = matrix->nb_col;
+  T_t g = 0;
+  for (size_t k = 0; k < n; ++k) {
+    g = gho_T_gcd(g, row[k]);
+    if (g == 1) { return; }
+  }
+  if (g == 0) { return; }
+  const gho_divider_t divider = gho_divider_create(g);
+  gho_matrix_T_div_exact_row(matrix, i, &divider);
+}
+#elif defined(gho_T_mpz)
+/**
+ * \brief Divide a row by the greatest common divisor of its elements
+ * \param[in] matrix A gho_matrix_T
+ * \param[in] i      Index of a row
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_normalize_row(gho_matrix_T_t* matrix, const size_t i) {
+  T_t* row = matrix->array[i];
+  const size_t n = matrix->nb_col;
+  mpz_t g;
+  mpz_init(g);
+  for (size_t k = 0; k < n && mpz_cmp_ui(g, 1) != 0; ++k) {
+    mpz_gcd(g, g, row[k].i);
+  }
+  if (mpz_cmp_ui(g, 1) > 0) {
+    for (size_t k = 0; k < n; ++k) {
+      mpz_divexact(row[k].i, row[k].i, g);
+    }
+  }
+  mpz_clear(g);
+}
+#endif
+
+#ifdef gho_T_integer
+/**
+ * \brief row_i[k] = floor(row_i[k] / d) for all k
+ * \param[in] matrix  A gho_matrix_T
+ * \param[in] i       Index of a row
+ * \param[in] divider A gho_divider_t of d
+ * \note The divisions are multiplications and shifts, see gho_divider_t
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_floor_div_q_row(gho_matrix_T_t* matrix, const size_t i,
+                                  const gho_divider_t* const divider) {
+  T_t* row = matrix->array[i];
+  const size_t n = matrix->nb_col;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t k = 0; k < n; ++k) {
+    row[k] = (T_t)gho_divider_floor_div_q(&local_divider, row[k]);
+  }
+}
+
+/**
+ * \brief row_i[k] = row_i[k] - d * floor(row_i[k] / d) for all k
+ * \param[in] matrix  A gho_matrix_T
+ * \param[in] i       Index of a row
+ * \param[in] divider A gho_divider_t of d
+ * \note The divisions are multiplications and shifts, see gho_divider_t
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_floor_div_r_row(gho_matrix_T_t* matrix, const size_t i,
+                                  const gho_divider_t* const divider) {
+  T_t* row = matrix->array[i];
+  const size_t n = matrix->nb_col;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t k = 0; k < n; ++k) {
+    row[k] = (T_t)gho_divider_floor_div_r(&local_divider, row[k]);
+  }
+}
+
+/**
+ * \brief row_i[k] = row_i[k] / d for all k, d divides all the row_i[k]
+ * \param[in] matrix  A gho_matrix_T
+ * \param[in] i       Index of a row
+ * \param[in] divider A gho_divider_t of d
+ * \note The divisions are multiplications by the inverse of d
+ * \warning The results are wrong for the row_i[k] not divisible by d
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_div_exact_row(gho_matrix_T_t* matrix, const size_t i,
+                                const gho_divider_t* const divider) {
+  T_t* row = matrix->array[i];
+  const size_t n = matrix->nb_col;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t k = 0; k < n; ++k) {
+    row[k] = (T_t)gho_divider_div_exact(&local_divider, row[k]);
+  }
+}
+
+/**
+ * \brief row_i[k] = row_i[k] modulo d for all k
+ * \param[in] matrix  A gho_matrix_T
+ * \param[in] i       Index of a row
+ * \param[in] divider A gho_divider_t of d
+ * \note The results are in [0, |d|)
+ * \note The divisions are multiplications and shifts, see gho_divider_t
+ * @relates gho_matrix_T_t
+ */
+void gho_matrix_T_mod_row(gho_matrix_T_t* matrix, const size_t i,
+                          const gho_divider_t* const divider) {
+  T_t* row = matrix->array[i];
+  const size_t n = matrix->nb_col;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t k = 0; k < n; ++k) {
+    row[k] = (T_t)gho_divider_mod(&local_divider, row[k]);
+  }
+}
+#endif
@@ -0,0 +1,412 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdint.h>
+#include <string.h>
+
+
+// Tag in the 16 high bits of gho_memory_header_t::info.size (the sizes are
+// less than 2^48 bytes): gho_realloc and gho_free recognize the memory of
+// gho_malloc (no tag with a 32-bit size_t)
+#if SIZE_MAX > 0xFFFFFFFFu
+  #define gho_memory_tag_ ((size_t)0x67B0 << 48)
+  #define gho_memory_tag_mask_ ((size_t)0xFFFF << 48)
+#else
+  #define gho_memory_tag_ ((size_t)0)
+  #define gho_memory_tag_mask_ ((size_t)0)
+#endif
+
+
+// Allocator
+
+/**
+ * \brief malloc for gho_allocator_malloc
+ * \param[in] allocator A gho_allocator_t
+ * \param[in] size      Size (bytes)
+ * \return malloc(size)
+ * \warning Do not use this function, it is used by gho_malloc
+ * @ingroup gho_memory
+ */
+void* gho_allocator_malloc_alloc_(gho_allocator_t* allocator,
+                                  const size_t size) {
+  (void)allocator;
+  return malloc(size);
+}
+
+/**
+ * \brief realloc for gho_allocator_malloc
+ * \param[in] allocator A gho_allocator_t
+ * \param[in] p         A block
+ * \param[in] old_size  Old size (bytes)
+ * \param[in] size      Size (bytes)
+ * \return realloc(p, size)
+ * \warning Do not use this function, it is used by gho_realloc
+ * @ingroup gho_memory
+ */
+void* gho_allocator_malloc_realloc_(gho_allocator_t* allocator, void* p,
+                                    const size_t old_size, const size_t size) {
+  (void)allocator; (void)old_size;
+  return realloc(p, size);
+}
+
+/**
+ * \brief free for gho_allocator_malloc
+ * \param[in] allocator A gho_allocator_t
+ * \param[in] p         A block
+ * \param[in] size      Size (bytes)
+ * \warning Do not use this function, it is used by gho_free
+ * @ingroup gho_memory
+ */
+void gho_allocator_malloc_free_(gho_allocator_t* allocator, void* p,
+                                const size_t size) {
+  (void)allocator; (void)size;
+  free(p);
+}
+
+/**
+ * \brief Return a new gho_allocator_t (with the counters to 0)
+ * \param[in] alloc_fct   Allocation function
+ * \param[in] realloc_fct Reallocation function
+ * \param[in] free_fct    Free function
+ * \return a new gho_allocator_t (with non-atomic counters)
+ * @ingroup gho_memory
+ */
+gho_allocator_t gho_allocator_create(
+  void* (*alloc_fct)(gho_allocator_t* allocator, const size_t size),
+  void* (*realloc_fct)(gho_allocator_t* allocator, void* p,
+                       const size_t old_size, const size_t size),
+  void (*free_fct)(gho_allocator_t* allocator, void* p, const size_t size)) {
+  gho_allocator_t allocator;
+  allocator.alloc_fct = alloc_fct;
+  allocator.realloc_fct = realloc_fct;
+  allocator.free_fct = free_fct;
+  allocator.nb_alloc = 0;
+  allocator.nb_realloc = 0;
+  allocator.nb_free = 0;
+  allocator.size = 0;
+  allocator.size_max = 0;
+  allocator.atomic_counters = false;
+  return allocator;
+}
+
+/**
+ * \brief Initializer of the allocator which uses malloc, realloc and free
+ * \warning Do not use this macro, use gho_allocator_malloc
+ * @ingroup gho_memory
+ */
+#define gho_allocator_malloc_initializer_ \
+  { \
+    gho_allocator_malloc_alloc_, \
+    gho_allocator_malloc_realloc_, \
+    gho_allocator_malloc_free_, \
+    0, 0, 0, 0, 0, \
+    true \
+  }
+
+#ifndef gho_with_local_allocator
+  extern gho_allocator_t gho_allocator_malloc_global_;
+  extern gho_thread_local gho_allocator_t* gho_allocator_current_global_;
+  #if defined(gho_global_allocator_implementation)
+    /// \brief Allocator of gho_allocator_malloc shared by the files
+    gho_allocator_t gho_allocator_malloc_global_ =
+      gho_allocator_malloc_initializer_;
+    /// \brief Current allocator of the thread shared by the files
+    gho_thread_local gho_allocator_t* gho_allocator_current_global_ = NULL;
+  #elif (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+    // One definition by file, the linker keeps one of them
+    __attribute__((weak))
+    gho_allocator_t gho_allocator_malloc_global_ =
+      gho_allocator_malloc_initializer_;
+    __attribute__((weak))
+    gho_thread_local gho_allocator_t* gho_allocator_current_global_ = NULL;
+  #endif
+#endif
+
+/**
+ * \brief Return the allocator which uses malloc, realloc and free
+ * \return the allocator which uses malloc, realloc and free
+ * \note With gho_with_local_allocator, each translation unit has its own
+ *       allocator (and its own counters)
+ * @ingroup gho_memory
+ */
+gho_allocator_t* gho_allocator_malloc() {
+  #ifndef gho_with_local_allocator
+    return &gho_allocator_malloc_global_;
+  #else
+    static gho_allocator_t allocator = gho_allocator_malloc_initializer_;
+    return &allocator;
+  #endif
+}
+
+/**
+ * \brief Return the current allocator
+ * \return the current allocator of the thread (NULL for gho_allocator_malloc)
+ * \warning Do not use this function, use gho_allocator and gho_allocator_set
+ * @ingroup gho_memory
+ */
+gho_allocator_t** gho_allocator_current_() {
+  #ifndef gho_with_local_allocator
+    return &gho_allocator_current_global_;
+  #else
+    static gho_thread_local gho_allocator_t* current = NULL;
+    return &current;
+  #endif
+}
+
+/**
+ * \brief Return the current allocator
+ * \return the current allocator
+ * @ingroup gho_memory
+ */
+gho_allocator_t* gho_allocator() {
+  gho_allocator_t* const current = *gho_allocator_current_();
+  return (current == NULL) ? gho_allocator_malloc() : current;
+}
+
+/**
+ * \brief Update the counters of an allocator
+ * \param[in] allocator A gho_allocator_t
+ * \param[in] counter   Counter of the operation (nb_alloc, nb_realloc or
+ *                      nb_free of the allocator)
+ * \param[in] old_size  Size before the operation (bytes)
+ * \param[in] size      Size after the operation (bytes)
+ * \warning Do not use this function, it is used by gho_malloc, gho_realloc
+ *          and gho_free
+ * @ingroup gho_memory
+ */
+void gho_allocator_count_(gho_allocator_t* allocator, size_t* counter,
+                          const size_t old_size, const size_t size) {
+  #ifdef __GNUC__
+  if (allocator->atomic_counters) {
+    __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+    // size - old_size wraps around when the size decreases
+    const size_t new_size = __atomic_add_fetch(&allocator->size,
+                                               size - old_size,
+                                               __ATOMIC_RELAXED);
+    size_t size_max = __atomic_load_n(&allocator->size_max, __ATOMIC_RELAXED);
+    while (new_size > size_max &&
+           __atomic_compare_exchange_n(&allocator->size_max, &size_max,
+                                       new_size, true, __ATOMIC_RELAXED,
+                                       __ATOMIC_RELAXED) == false) { }
+    return;
+  }
+  #endif
+  ++(*counter);
+  allocator->size = allocator->size - old_size + size;
+  if (allocator->size > allocator->size_max) {
+    allocator->size_max = allocator->size;
+  }
+}
+
+/**
+ * \brief Return a counter of an allocator
+ * \param[in] allocator A gho_allocator_t
+ * \param[in] counter   A counter of the allocator
+ * \return the value of the counter
+ * \warning Do not use this function, it is used by
+ *          gho_allocator_fprint_counters
+ * @ingroup gho_memory
+ */
+size_t gho_allocator_counter_(const gho_allocator_t* const allocator,
+                              const size_t* const counter) {
+  #ifdef __GNUC__
+  if (allocator->atomic_counters) {
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+  }
+  #else
+  (void)allocator;
+  #endif
+  return *counter;
+}
+
+/**
+ * \brief Set the current allocator
+ * \param[in] allocator A gho_allocator_t (NULL for gho_allocator_malloc)
+ * \return the previous allocator (to restore it at the end of the scope)
+ * @ingroup gho_memory
+ */
+gho_allocator_t* gho_allocator_set(gho_allocator_t* allocator) {
+  gho_allocator_t* const previous = gho_allocator();
+  *gho_allocator_current_() = allocator;
+  return previous;
+}
+
+/**
+ * \brief Set the counters of an allocator to 0 (size_max = size)
+ * \param[in] allocator A gho_allocator_t
+ * \warning The other threads must not use the allocator during the reset
+ * @ingroup gho_memory
+ */
+void gho_allocator_reset_counters(gho_allocator_t* allocator) {
+  allocator->nb_alloc = 0;
+  allocator->nb_realloc = 0;
+  allocator->nb_free = 0;
+  allocator->size_max = allocator->size;
+}
+
+/**
+ * \brief Print the counters of an allocator in a file
+ * \param[in] file      A C file
+ * \param[in] allocator A gho_allocator_t
+ * @ingroup gho_memory
+ */
+void gho_allocator_fprint_counters(FILE* file,
+                                   const gho_allocator_t* const allocator) {
+  const gho_allocator_t* const a = allocator;
+  fprintf(file, "alloc: %lu, realloc: %lu, free: %lu, "
+                "size: %lu, size max: %lu",
+          (unsigned long)gho_allocator_counter_(a, &a->nb_alloc),
+          (unsigned long)gho_allocator_counter_(a, &a->nb_realloc),
+          (unsigned long)gho_allocator_counter_(a, &a->nb_free),
+          (unsigned long)gho_allocator_counter_(a, &a->size),
+          (unsigned long)gho_allocator_counter_(a, &a->size_max));
+}
+
+// Allocation
+
+/**
+ * \brief Return the size of a block of gho_malloc
+ * \param[in] fonction_name Name of the function (for the error)
+ * \param[in] header        Header of a block of gho_malloc
+ * \return the size of the block (bytes)
+ * \warning Do not use this function, it is used by gho_realloc and gho_free
+ * @ingroup gho_memory
+ */
+size_t gho_memory_size_(const char* const fonction_name,
+                        const gho_memory_header_t* const header) {
+  #ifndef NDEBUG
+    if ((header->info.size & gho_memory_tag_mask_) != gho_memory_tag_) {
+      fprintf(stderr, "ERROR: %s: the memory is not of gho_malloc (memory of "
+                      "malloc or freed twice)!\n", fonction_name);
+      exit(1);
+    }
+  #else
+    (void)fonction_name;
+  #endif
+  return header->info.size & ~gho_memory_tag_mask_;
+}
+
+/**
+ * \brief Allocate memory with the current allocator
+ * \param[in] size Size (bytes)
+ * \return the memory allocated (free it with gho_free)
+ * @ingroup gho_memory
+ */
+void* gho_malloc(const size_t size) {
+  gho_allocator_t* allocator = gho_allocator();
+  gho_memory_header_t* header = NULL;
+  if ((size & gho_memory_tag_mask_) == 0) {
+    header = (gho_memory_header_t*)
+      allocator->alloc_fct(allocator, sizeof(gho_memory_header_t) + size);
+  }
+  if (header == NULL) {
+    fprintf(stderr, "ERROR: gho_malloc: out of memory!\n");
+    exit(1);
+  }
+  header->info.allocator = allocator;
+  header->info.size = size | gho_memory_tag_;
+  gho_allocator_count_(allocator, &allocator->nb_alloc, 0, size);
+  return header + 1;
+}
+
+/**
+ * \brief Reallocate memory with its allocator
+ * \param[in] p    Memory of gho_malloc (or NULL, not memory of malloc)
+ * \param[in] size New size (bytes)
+ * \return the memory reallocated (free it with gho_free)
+ * @ingroup gho_memory
+ */
+void* gho_realloc(void* p, const size_t size) {
+  if (p == NULL) { return gho_malloc(size); }
+  gho_memory_header_t* header = (gho_memory_header_t*)p - 1;
+  gho_allocator_t* allocator = header->info.allocator;
+  const size_t old_size = gho_memory_size_("gho_realloc", header);
+  if ((size & gho_memory_tag_mask_) == 0) {
+    header = (gho_memory_header_t*)
+      allocator->realloc_fct(allocator, header,
+                             sizeof(gho_memory_header_t) + old_size,
+                             sizeof(gho_memory_header_t) + size);
+  }
+  else { header = NULL; }
+  if (header == NULL) {
+    fprintf(stderr, "ERROR: gho_realloc: out of memory!\n");
+    exit(1);
+  }
+  header->info.size = size | gho_memory_tag_;
+  gho_allocator_count_(allocator, &allocator->nb_realloc, old_size, size);
+  return header + 1;
+}
+
+/**
+ * \brief Free memory with its allocator
+ * \param[in] p Memory of gho_malloc (or NULL)
+ * \warning p must not be memory of malloc (see gho_absorb_malloc)
+ * @ingroup gho_memory
+ */
+void gho_free(void* p) {
+  if (p == NULL) { return; }
+  gho_memory_header_t* header = (gho_memory_header_t*)p - 1;
+  gho_allocator_t* allocator = header->info.allocator;
+  const size_t size = gho_memory_size_("gho_free", header);
+  header->info.size = size; // Untagged: a second gho_free is detected
+  gho_allocator_count_(allocator, &allocator->nb_free, size, 0);
+  allocator->free_fct(allocator, header, sizeof(gho_memory_header_t) + size);
+}
+
+/**
+ * \brief Move memory of malloc into memory of gho_malloc
+ * \param[in] p    Memory of malloc, calloc or realloc (size bytes at least)
+ * \param[in] size Size (bytes)
+ * \return the memory of gho_malloc with the size first bytes of p (free it
+ *         with gho_free); its allocator is gho_allocator_malloc
+ * \warning p is moved, do not use it after this function
+ * \note The block is extended with realloc and its bytes are moved by the
+ *       size of a gho_memory_header_t: there is no second allocation
+ * @ingroup gho_memory
+ */
+void* gho_absorb_malloc(void* p, const size_t size) {
+  gho_allocator_t* allocator = gho_allocator_malloc();
+  gho_memory_header_t* header = (gho_memory_header_t*)
+    realloc(p, sizeof(gho_memory_header_t) + size);
+  if (header == NULL) {
+    fprintf(stderr, "ERROR: gho_absorb_malloc: out of memory!\n");
+    exit(1);
+  }
+  memmove(header + 1, header, size);
+  header->info.allocator = allocator;
+  header->info.size = size | gho_memory_tag_;
+  gho_allocator_count_(allocator, &allocator->nb_alloc, 0, size);
+  return header + 1;
+}
+
+// Growth
+
+/**
+ * \brief Return the new capacity of a dynamic array which needs n elements
+ * \param[in] capacity Current capacity
+ * \param[in] n        Number of elements needed
+ * \return the new capacity (capacity * gho_growth_numerator /
+ *         gho_growth_denominator, at least n and gho_growth_min_capacity)
+ * @ingroup gho_memory
+ */
+size_t gho_growth(const size_t capacity, const size_t n) {
+  size_t r = capacity;
+  if (capacity <= SIZE_MAX / gho_growth_numerator) {
+    r = capacity * gho_growth_numerator / gho_growth_denominator;
+  }
+  if (r < gho_growth_min_capacity) { r = gho_growth_min_capacity; }
+  if (r < n) { r = n; }
+  return r;
+}
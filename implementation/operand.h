@@ -59,9 +59,13 @@ void gho_operand_destroy(gho_operand_t* op) {
   else if (op->type == GHO_TYPE_GHO_MPZ_T) {
     gho_mpz_destroy((gho_mpz_t*)(op->p));
   }
+  // gho_smpz_t
+  else if (op->type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_destroy((gho_smpz_t*)(op->p));
+  }
   #endif
   
-  free(op->p);
+  gho_free(op->p);
   
   op->type = GHO_TYPE_NULL;
   op->p = NULL;
@@ -163,6 +167,11 @@ void gho_operand_copy_(const gho_operand_t* const op, gho_operand_t* copy) {
     copy->p = gho_alloc(gho_mpz_t);
     *(gho_mpz_t*)copy->p = gho_mpz_copy((gho_mpz_t*)(op->p));
   }
+  // gho_smpz_t
+  else if (copy->type == GHO_TYPE_GHO_SMPZ_T) {
+    copy->p = gho_alloc(gho_smpz_t);
+    *(gho_smpz_t*)copy->p = gho_smpz_copy((gho_smpz_t*)(op->p));
+  }
   #endif
 }
 
@@ -204,7 +213,9 @@ void gho_coperand_copy_(const gho_coperand_t* const cop, gho_coperand_t* copy) {
  */
 gho_string_t gho_operand_to_string(const gho_operand_t* const i) {
   gho_string_t r = gho_string_create();
-  gho_operand_sprint(&r.c_str, i);
+  char* c_str = gho_c_str_create();
+  gho_operand_sprint(&c_str, i);
+  gho_string_absorb_c_str(&r, &c_str);
   return r;
 }
 
@@ -218,11 +229,14 @@ gho_string_t gho_operand_to_string(const gho_operand_t* const i) {
  */
 gho_string_t gho_coperand_to_string(const gho_coperand_t* const i) {
   gho_string_t r = gho_string_create();
-  gho_coperand_sprint(&r.c_str, i);
+  char* c_str = gho_c_str_create();
+  gho_coperand_sprint(&c_str, i);
+  gho_string_absorb_c_str(&r, &c_str);
   return r;
 }
 
 #include "operand/type_error.h"
+#include "operand/overflow.h"
 #include "operand/assignment.h"
 #include "operand/binary_operators.h"
 #include "operand/binary_operators_with_immediate.h"
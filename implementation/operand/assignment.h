@@ -179,6 +179,34 @@ void gho_set(gho_operand_t r, const gho_operand_t i) {
   else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
     mpz_set((*(gho_mpz_t*)(r.p)).i, (*(gho_mpz_t*)(i.p)).i);
   }
+  
+  // gho_smpz_t & int, gho_lint, gho_llint
+  else if (r.type == GHO_TYPE_GHO_SMPZ_T &&
+           (i.type == GHO_TYPE_INT || i.type == GHO_TYPE_LINT ||
+            i.type == GHO_TYPE_LLINT)) {
+    gho_smpz_set_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+  }
+  // gho_smpz_t & gho_mpz_t
+  else if (r.type == GHO_TYPE_GHO_SMPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
+    gho_smpz_set_mpz((gho_smpz_t*)(r.p), (gho_mpz_t*)(i.p));
+  }
+  // gho_smpz_t & gho_smpz_t
+  else if (r.type == GHO_TYPE_GHO_SMPZ_T && i.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_set((gho_smpz_t*)(r.p), (gho_smpz_t*)(i.p));
+  }
+  // gho_mpz_t & gho_smpz_t
+  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_SMPZ_T) {
+    const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+    if (p_i->is_mpz) { mpz_set((*(gho_mpz_t*)(r.p)).i, p_i->i.big); }
+    else { mpz_set_si((*(gho_mpz_t*)(r.p)).i, p_i->i.small); }
+  }
+  // int, gho_lint, gho_llint & gho_smpz_t
+  else if ((r.type == GHO_TYPE_INT || r.type == GHO_TYPE_LINT ||
+            r.type == GHO_TYPE_LLINT) &&
+           i.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_lint tmp = gho_smpz_get_li((gho_smpz_t*)(i.p));
+    gho_set(r, gho_operand_type(&tmp, GHO_TYPE_LINT));
+  }
   #endif
   
   // Other
@@ -18,715 +18,1802 @@
 
 // Binary operators: + - * / % pow gcd
 
-// Overflow detection: http://stackoverflow.com/a/1514309
+// Dispatch table
 
 /**
- * \brief r += i
+ * \brief Number of indexes of the dispatch tables of the binary operators
+ *        (int, gho_lint, gho_llint, gho_mpz_t, gho_smpz_t)
+ */
+#define gho_operand_type_nb 5
+
+/**
+ * \brief Function of a dispatch table which needs GMP (NULL without GMP)
+ * \param[in] f A function of the binary operators
+ */
+#ifdef gho_with_gmp
+  #define gho_operand_gmp_fct_(f) f
+#else
+  #define gho_operand_gmp_fct_(f) NULL
+#endif
+
+/**
+ * \brief Function r op= i for one (r.type, i.type)
+ */
+typedef void (*gho_operand_binary_fct_t)(gho_operand_t, const gho_operand_t);
+
+static inline
+size_t gho_operand_type_index_(const gho_type_t type);
+static inline
+void gho_operand_binary_dispatch(const char* const fonction_name,
+                                 const gho_operand_binary_fct_t table
+                                   [gho_operand_type_nb][gho_operand_type_nb],
+                                 gho_operand_t r, const gho_operand_t i);
+
+// r op= i for each (r.type, i.type)
+static inline
+void gho_add_int_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_int_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_int_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_add_int_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_add_lint_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_lint_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_lint_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_add_lint_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_add_llint_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_llint_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_llint_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_add_llint_mpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_mpz_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_mpz_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_mpz_llint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_mpz_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+#ifdef gho_with_gmp
+static inline
+void gho_add_int_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_lint_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_llint_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_mpz_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_smpz_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_smpz_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_smpz_llint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_smpz_mpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_add_smpz_smpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_sub_int_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_int_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_int_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_sub_int_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_sub_lint_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_lint_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_lint_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_sub_lint_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_sub_llint_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_llint_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_llint_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_sub_llint_mpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_mpz_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_mpz_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_mpz_llint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_mpz_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+#ifdef gho_with_gmp
+static inline
+void gho_sub_int_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_lint_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_llint_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_mpz_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_smpz_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_smpz_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_smpz_llint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_smpz_mpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_sub_smpz_smpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_mul_int_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_int_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_int_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_mul_int_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_mul_lint_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_lint_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_lint_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_mul_lint_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+static inline
+void gho_mul_llint_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_llint_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_llint_llint_(gho_operand_t r, const gho_operand_t i);
+#ifdef gho_with_gmp
+static inline
+void gho_mul_llint_mpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_mpz_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_mpz_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_mpz_llint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_mpz_mpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+#ifdef gho_with_gmp
+static inline
+void gho_mul_int_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_lint_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_llint_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_mpz_smpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_smpz_int_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_smpz_lint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_smpz_llint_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_smpz_mpz_(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_mul_smpz_smpz_(gho_operand_t r, const gho_operand_t i);
+#endif
+
+/**
+ * \brief Return the index of a gho_type_t in the dispatch tables
+ * \param[in] type A gho_type_t
+ * \return the index of the type in the dispatch tables of the binary
+ *         operators, gho_operand_type_nb if the type is not in the tables
+ * \warning Do not use this function, it is used by
+ *          gho_operand_binary_dispatch
+ */
+size_t gho_operand_type_index_(const gho_type_t type) {
+  switch (type) {
+    case GHO_TYPE_INT: return 0;
+    case GHO_TYPE_LINT: return 1;
+    case GHO_TYPE_LLINT: return 2;
+    case GHO_TYPE_GHO_MPZ_T: return 3;
+    case GHO_TYPE_GHO_SMPZ_T: return 4;
+    default: return gho_operand_type_nb;
+  }
+}
+
+/**
+ * \brief Call the function of the table for (r.type, i.type)
+ * \param[in] fonction_name Name of the function (for the error)
+ * \param[in] table         Functions indexed by the types of r and i
+ * \param[in] r             A gho_operand_t
+ * \param[in] i             A gho_operand_t
+ * \warning Do not use this function, it is used by gho_add, gho_sub, gho_mul
+ */
+void gho_operand_binary_dispatch(const char* const fonction_name,
+                                 const gho_operand_binary_fct_t table
+                                   [gho_operand_type_nb][gho_operand_type_nb],
+                                 gho_operand_t r, const gho_operand_t i) {
+  const size_t r_index = gho_operand_type_index_(r.type);
+  const size_t i_index = gho_operand_type_index_(i.type);
+  if (r_index < gho_operand_type_nb && i_index < gho_operand_type_nb &&
+      table[r_index][i_index] != NULL) {
+    table[r_index][i_index](r, i);
+  }
+  else {
+    gho_operand_type_error_2(fonction_name, r, i);
+  }
+}
+
+// + - *
+
+// Overflow detection: gho_*_overflow (overflow.h), the overflow function is
+// called instead of storing a wrong result silently
+
+/**
+ * \brief r += i with r a int and i a int
  * \param[in] r A gho_operand_t
  * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
  * @relates gho_operand_t
  */
-void gho_add(gho_operand_t r, const gho_operand_t i) {
-  
-  // int & int
-  if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_INT) {
-    int* p_r = (int*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, int) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, int) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += *p_i;
-  }
-  // int & gho_lint
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_LINT) {
-    int* p_r = (int*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, gho_lint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, gho_lint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += (int)*p_i;
+void gho_add_int_int_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  int tmp;
+  if (gho_int_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  // int & gho_llint
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_LLINT) {
-    int* p_r = (int*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, gho_llint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, gho_llint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += (int)*p_i;
+  else {
+    *p_r = tmp;
   }
-  #ifdef gho_with_gmp
-  // int & gho_mpz_t
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_GHO_MPZ_T) {
-    int* p_r = (int*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r > 0 && p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(int, gho_mpz_t) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += (int)p_i;
+}
+
+/**
+ * \brief r += i with r a int and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_int_lint_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  int tmp;
+  if (gho_int_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  #endif
-  
-  // gho_lint & int
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_INT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, int) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, int) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += *p_i;
+  else {
+    *p_r = tmp;
   }
-  // gho_lint & gho_lint
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_LINT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, gho_lint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, gho_lint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += *p_i;
+}
+
+/**
+ * \brief r += i with r a int and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_int_llint_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  int tmp;
+  if (gho_int_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  // gho_lint & gho_llint
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_LLINT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, gho_llint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, gho_llint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += (gho_lint)*p_i;
+  else {
+    *p_r = tmp;
   }
-  #ifdef gho_with_gmp
-  // gho_lint & gho_mpz_t
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r > 0 && p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_lint, gho_mpz_t) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += (gho_lint)p_i;
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a int and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_int_mpz_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  int tmp;
+  if (gho_int_add_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  #endif
-  
-  // gho_llint & int
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_INT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, int) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, int) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += *p_i;
+  else {
+    *p_r = tmp;
   }
-  // gho_llint & gho_lint
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_LINT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, gho_lint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, gho_lint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += *p_i;
+}
+#endif
+
+/**
+ * \brief r += i with r a gho_lint and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_lint_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  // gho_llint & gho_llint
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_LLINT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, gho_llint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, gho_llint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += *p_i;
+  else {
+    *p_r = tmp;
   }
-  #ifdef gho_with_gmp
-  // gho_llint & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r > 0 && p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_add(gho_llint, gho_mpz_t) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r += p_i;
+}
+
+/**
+ * \brief r += i with r a gho_lint and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_lint_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  #endif
-  
-  #ifdef gho_with_gmp
-  // gho_mpz_t & int
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_INT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    if (*p_i > 0) {
-      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
-    }
-    else if (*p_i < 0) {
-      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
-    }
+  else {
+    *p_r = tmp;
   }
-  // gho_mpz_t & gho_lint
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_LINT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    if (*p_i > 0) {
-      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
-    }
-    else if (*p_i < 0) {
-      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
-    }
+}
+
+/**
+ * \brief r += i with r a gho_lint and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_lint_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  // gho_mpz_t & gho_llint
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_LLINT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint tmp_i = gho_operand_to_li(i);
-    if (tmp_i > 0) {
-      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)tmp_i);
-    }
-    else if (tmp_i < 0) {
-      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-tmp_i);
-    }
+  else {
+    *p_r = tmp;
   }
-  // gho_mpz_t & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
-    mpz_add(p_r->i, p_r->i, p_i->i);
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_lint and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_lint_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_lint tmp;
+  if (gho_lint_add_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  #endif
-  
-  // Other
   else {
-    gho_operand_type_error_2("gho_add", r, i);
+    *p_r = tmp;
   }
 }
+#endif
 
 /**
- * \brief r -= i
+ * \brief r += i with r a gho_llint and i a int
  * \param[in] r A gho_operand_t
  * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
  * @relates gho_operand_t
  */
-void gho_sub(gho_operand_t r, const gho_operand_t i) {
-  
-  // int & int
-  if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_INT) {
-    int* p_r = (int*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, int) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, int) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= *p_i;
+void gho_add_llint_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  // int & gho_lint
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_LINT) {
-    int* p_r = (int*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, gho_lint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, gho_lint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= (int)*p_i;
+  else {
+    *p_r = tmp;
   }
-  // int & gho_llint
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_LLINT) {
-    int* p_r = (int*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, gho_llint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, gho_llint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= (int)*p_i;
+}
+
+/**
+ * \brief r += i with r a gho_llint and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_llint_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  #ifdef gho_with_gmp
-  // int & gho_mpz_t
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_GHO_MPZ_T) {
-    int* p_r = (int*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r > 0 && p_i < 0 && -p_i > INT_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && p_i > 0 && -p_i < INT_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(int, gho_mpz_t) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= (int)p_i;
+  else {
+    *p_r = tmp;
   }
-  #endif
-  
-  // gho_lint & int
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_INT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, int) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, int) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r-= *p_i;
+}
+
+/**
+ * \brief r += i with r a gho_llint and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_llint_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_add_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
   }
-  // gho_lint & gho_lint
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_LINT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, gho_lint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, gho_lint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= *p_i;
+  else {
+    *p_r = tmp;
   }
-  // gho_lint & gho_llint
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_LLINT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, gho_llint) overflow!\n");
-      exit(1);
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_llint and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_llint_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_llint tmp;
+  if (gho_llint_add_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_mpz_t and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_mpz_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  if (*p_i > 0) {
+    mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
+  }
+  else if (*p_i < 0) {
+    mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_mpz_t and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_mpz_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  if (*p_i > 0) {
+    mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
+  }
+  else if (*p_i < 0) {
+    mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_mpz_t and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_mpz_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_lint tmp_i = gho_operand_to_li(i);
+  if (tmp_i > 0) {
+    mpz_add_ui(p_r->i, p_r->i, (gho_ulint)tmp_i);
+  }
+  else if (tmp_i < 0) {
+    mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-tmp_i);
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_mpz_t and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_mpz_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
+  mpz_add(p_r->i, p_r->i, p_i->i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a int and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_int_smpz_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  int tmp;
+  if (gho_int_add_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_lint and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_lint_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_lint tmp;
+  if (gho_lint_add_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_llint and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_llint_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_llint tmp;
+  if (gho_llint_add_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_add", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_mpz_t and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_mpz_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+  if (p_i->is_mpz) {
+    mpz_add(p_r->i, p_r->i, p_i->i.big);
+  }
+  else {
+    if (p_i->i.small > 0) {
+      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)p_i->i.small);
     }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, gho_llint) underflow!\n");
-      exit(1);
+    else if (p_i->i.small < 0) {
+      mpz_sub_ui(p_r->i, p_r->i, -(gho_ulint)p_i->i.small);
     }
-    #endif
-    *p_r -= (gho_lint)*p_i;
   }
-  #ifdef gho_with_gmp
-  // gho_lint & gho_mpz_t
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r > 0 && p_i < 0 && -p_i > LONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && p_i > 0 && -p_i < LONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_lint, gho_mpz_t) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= (gho_lint)p_i;
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_smpz_t and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_smpz_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_add_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_smpz_t and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_smpz_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_add_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_smpz_t and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_smpz_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_add_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_smpz_t and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_smpz_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_add_mpz((gho_smpz_t*)(r.p), (gho_mpz_t*)(i.p));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r += i with r a gho_smpz_t and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_add
+ * @relates gho_operand_t
+ */
+void gho_add_smpz_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_t* p_r = (gho_smpz_t*)(r.p);
+  const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+  // Fast path: two gho_lint and no overflow
+  gho_lint tmp;
+  if (p_r->is_mpz == false && p_i->is_mpz == false &&
+      gho_lint_add_overflow(p_r->i.small, p_i->i.small, &tmp) == false) {
+    p_r->i.small = tmp;
+  }
+  else {
+    gho_smpz_add(p_r, p_i);
+  }
+}
+#endif
+
+/**
+ * \brief r += i
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * @relates gho_operand_t
+ */
+void gho_add(gho_operand_t r, const gho_operand_t i) {
+  // Indexed by gho_operand_type_index_ (positional: C++ compatible)
+  static const gho_operand_binary_fct_t table[gho_operand_type_nb]
+                                               [gho_operand_type_nb] = {
+    { // r: int
+      gho_add_int_int_,
+      gho_add_int_lint_,
+      gho_add_int_llint_,
+      gho_operand_gmp_fct_(gho_add_int_mpz_),
+      gho_operand_gmp_fct_(gho_add_int_smpz_)
+    },
+    { // r: gho_lint
+      gho_add_lint_int_,
+      gho_add_lint_lint_,
+      gho_add_lint_llint_,
+      gho_operand_gmp_fct_(gho_add_lint_mpz_),
+      gho_operand_gmp_fct_(gho_add_lint_smpz_)
+    },
+    { // r: gho_llint
+      gho_add_llint_int_,
+      gho_add_llint_lint_,
+      gho_add_llint_llint_,
+      gho_operand_gmp_fct_(gho_add_llint_mpz_),
+      gho_operand_gmp_fct_(gho_add_llint_smpz_)
+    },
+    { // r: gho_mpz_t
+      gho_operand_gmp_fct_(gho_add_mpz_int_),
+      gho_operand_gmp_fct_(gho_add_mpz_lint_),
+      gho_operand_gmp_fct_(gho_add_mpz_llint_),
+      gho_operand_gmp_fct_(gho_add_mpz_mpz_),
+      gho_operand_gmp_fct_(gho_add_mpz_smpz_)
+    },
+    { // r: gho_smpz_t
+      gho_operand_gmp_fct_(gho_add_smpz_int_),
+      gho_operand_gmp_fct_(gho_add_smpz_lint_),
+      gho_operand_gmp_fct_(gho_add_smpz_llint_),
+      gho_operand_gmp_fct_(gho_add_smpz_mpz_),
+      gho_operand_gmp_fct_(gho_add_smpz_smpz_)
+    }
+  };
+  gho_operand_binary_dispatch("gho_add", table, r, i);
+}
+
+/**
+ * \brief r -= i with r a int and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_int_int_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  int tmp;
+  if (gho_int_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r -= i with r a int and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_int_lint_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  int tmp;
+  if (gho_int_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r -= i with r a int and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_int_llint_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  int tmp;
+  if (gho_int_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a int and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_int_mpz_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  int tmp;
+  if (gho_int_sub_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+/**
+ * \brief r -= i with r a gho_lint and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_lint_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r -= i with r a gho_lint and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_lint_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r -= i with r a gho_lint and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_lint_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_lint and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_lint_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_lint tmp;
+  if (gho_lint_sub_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+/**
+ * \brief r -= i with r a gho_llint and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_llint_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r -= i with r a gho_llint and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_llint_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r -= i with r a gho_llint and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_llint_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_sub_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_llint and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_llint_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_llint tmp;
+  if (gho_llint_sub_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_mpz_t and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_mpz_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  if (*p_i > 0) {
+    mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
+  }
+  else if (*p_i < 0) {
+    mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_mpz_t and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_mpz_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  if (*p_i > 0) {
+    mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
+  }
+  else if (*p_i < 0) {
+    mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_mpz_t and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_mpz_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_lint tmp_i = gho_operand_to_li(i);
+  if (tmp_i > 0) {
+    mpz_add_ui(p_r->i, p_r->i, (gho_ulint)tmp_i);
+  }
+  else if (tmp_i < 0) {
+    mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-tmp_i);
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_mpz_t and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_mpz_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
+  mpz_add(p_r->i, p_r->i, p_i->i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a int and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_int_smpz_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  int tmp;
+  if (gho_int_sub_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_lint and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_lint_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_lint tmp;
+  if (gho_lint_sub_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_llint and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_llint_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_llint tmp;
+  if (gho_llint_sub_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_sub", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_mpz_t and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_mpz_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+  if (p_i->is_mpz) {
+    mpz_sub(p_r->i, p_r->i, p_i->i.big);
   }
-  #endif
-  
-  // gho_llint & int
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_INT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, int) overflow!\n");
-      exit(1);
+  else {
+    if (p_i->i.small > 0) {
+      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)p_i->i.small);
     }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, int) underflow!\n");
-      exit(1);
+    else if (p_i->i.small < 0) {
+      mpz_add_ui(p_r->i, p_r->i, -(gho_ulint)p_i->i.small);
     }
-    #endif
-    *p_r -= *p_i;
   }
-  // gho_llint & gho_lint
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_LINT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, gho_lint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, gho_lint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= *p_i;
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_smpz_t and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_smpz_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_sub_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_smpz_t and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_smpz_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_sub_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_smpz_t and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_smpz_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_sub_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_smpz_t and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_smpz_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_sub_mpz((gho_smpz_t*)(r.p), (gho_mpz_t*)(i.p));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r -= i with r a gho_smpz_t and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_sub
+ * @relates gho_operand_t
+ */
+void gho_sub_smpz_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_t* p_r = (gho_smpz_t*)(r.p);
+  const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+  // Fast path: two gho_lint and no overflow
+  gho_lint tmp;
+  if (p_r->is_mpz == false && p_i->is_mpz == false &&
+      gho_lint_sub_overflow(p_r->i.small, p_i->i.small, &tmp) == false) {
+    p_r->i.small = tmp;
   }
-  // gho_llint & gho_llint
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_LLINT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r > 0 && *p_i < 0 && -*p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, gho_llint) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && *p_i > 0 && -*p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, gho_llint) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= *p_i;
+  else {
+    gho_smpz_sub(p_r, p_i);
   }
-  #ifdef gho_with_gmp
-  // gho_llint & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r > 0 && p_i < 0 && -p_i > LLONG_MAX - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, int) overflow!\n");
-      exit(1);
-    }
-    if (*p_r < 0 && p_i > 0 && -p_i < LLONG_MIN - *p_r) {
-      fprintf(stderr, "ERROR: gho_sub(gho_llint, int) underflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r -= p_i;
+}
+#endif
+
+/**
+ * \brief r -= i
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * @relates gho_operand_t
+ */
+void gho_sub(gho_operand_t r, const gho_operand_t i) {
+  // Indexed by gho_operand_type_index_ (positional: C++ compatible)
+  static const gho_operand_binary_fct_t table[gho_operand_type_nb]
+                                               [gho_operand_type_nb] = {
+    { // r: int
+      gho_sub_int_int_,
+      gho_sub_int_lint_,
+      gho_sub_int_llint_,
+      gho_operand_gmp_fct_(gho_sub_int_mpz_),
+      gho_operand_gmp_fct_(gho_sub_int_smpz_)
+    },
+    { // r: gho_lint
+      gho_sub_lint_int_,
+      gho_sub_lint_lint_,
+      gho_sub_lint_llint_,
+      gho_operand_gmp_fct_(gho_sub_lint_mpz_),
+      gho_operand_gmp_fct_(gho_sub_lint_smpz_)
+    },
+    { // r: gho_llint
+      gho_sub_llint_int_,
+      gho_sub_llint_lint_,
+      gho_sub_llint_llint_,
+      gho_operand_gmp_fct_(gho_sub_llint_mpz_),
+      gho_operand_gmp_fct_(gho_sub_llint_smpz_)
+    },
+    { // r: gho_mpz_t
+      gho_operand_gmp_fct_(gho_sub_mpz_int_),
+      gho_operand_gmp_fct_(gho_sub_mpz_lint_),
+      gho_operand_gmp_fct_(gho_sub_mpz_llint_),
+      gho_operand_gmp_fct_(gho_sub_mpz_mpz_),
+      gho_operand_gmp_fct_(gho_sub_mpz_smpz_)
+    },
+    { // r: gho_smpz_t
+      gho_operand_gmp_fct_(gho_sub_smpz_int_),
+      gho_operand_gmp_fct_(gho_sub_smpz_lint_),
+      gho_operand_gmp_fct_(gho_sub_smpz_llint_),
+      gho_operand_gmp_fct_(gho_sub_smpz_mpz_),
+      gho_operand_gmp_fct_(gho_sub_smpz_smpz_)
+    }
+  };
+  gho_operand_binary_dispatch("gho_sub", table, r, i);
+}
+
+/**
+ * \brief r *= i with r a int and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_int_int_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  int tmp;
+  if (gho_int_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
   }
-  #endif
-  
-  #ifdef gho_with_gmp
-  // gho_mpz_t & int
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_INT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    if (*p_i > 0) {
-      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
-    }
-    else if (*p_i < 0) {
-      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
-    }
+  else {
+    *p_r = tmp;
   }
-  // gho_mpz_t & gho_lint
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_LINT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    if (*p_i > 0) {
-      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)*p_i);
-    }
-    else if (*p_i < 0) {
-      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-*p_i);
-    }
+}
+
+/**
+ * \brief r *= i with r a int and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_int_lint_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  int tmp;
+  if (gho_int_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
   }
-  // gho_mpz_t & gho_llint
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_LLINT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint tmp_i = gho_operand_to_li(i);
-    if (tmp_i > 0) {
-      mpz_add_ui(p_r->i, p_r->i, (gho_ulint)tmp_i);
-    }
-    else if (tmp_i < 0) {
-      mpz_sub_ui(p_r->i, p_r->i, (gho_ulint)-tmp_i);
-    }
+  else {
+    *p_r = tmp;
   }
-  // gho_mpz_t & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
-    mpz_add(p_r->i, p_r->i, p_i->i);
+}
+
+/**
+ * \brief r *= i with r a int and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_int_llint_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  int tmp;
+  if (gho_int_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a int and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_int_mpz_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  int tmp;
+  if (gho_int_mul_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+/**
+ * \brief r *= i with r a gho_lint and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_lint_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r *= i with r a gho_lint and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_lint_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r *= i with r a gho_lint and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_lint_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  gho_lint tmp;
+  if (gho_lint_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_lint and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_lint_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_lint tmp;
+  if (gho_lint_mul_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+/**
+ * \brief r *= i with r a gho_llint and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_llint_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r *= i with r a gho_llint and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_llint_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+/**
+ * \brief r *= i with r a gho_llint and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_llint_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint* const p_i = (gho_llint*)(i.p);
+  gho_llint tmp;
+  if (gho_llint_mul_overflow(*p_r, *p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_llint and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_llint_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_llint tmp;
+  if (gho_llint_mul_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
+  }
+  else {
+    *p_r = tmp;
+  }
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_mpz_t and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_mpz_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const int* const p_i = (int*)(i.p);
+  mpz_mul_si(p_r->i, p_r->i, *p_i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_mpz_t and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_mpz_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_lint* const p_i = (gho_lint*)(i.p);
+  mpz_mul_si(p_r->i, p_r->i, *p_i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_mpz_t and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_mpz_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_lint tmp_i = gho_operand_to_li(i);
+  mpz_mul_si(p_r->i, p_r->i, tmp_i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_mpz_t and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_mpz_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
+  mpz_mul(p_r->i, p_r->i, p_i->i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a int and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_int_smpz_(gho_operand_t r, const gho_operand_t i) {
+  int* p_r = (int*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  int tmp;
+  if (gho_int_mul_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
   }
-  #endif
-  
-  // Other
   else {
-    gho_operand_type_error_2("gho_sub", r, i);
+    *p_r = tmp;
   }
 }
+#endif
 
+#ifdef gho_with_gmp
 /**
- * \brief r *= i
+ * \brief r *= i with r a gho_lint and i a gho_smpz_t
  * \param[in] r A gho_operand_t
  * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
  * @relates gho_operand_t
  */
-void gho_mul(gho_operand_t r, const gho_operand_t i) {
-  
-  // int & int
-  if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_INT) {
-    int* p_r = (int*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && abs(*p_i) > INT_MAX / abs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(int, int) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= *p_i;
-  }
-  // int & gho_lint
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_LINT) {
-    int* p_r = (int*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && labs(*p_i) > INT_MAX / abs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(int, gho_lint) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= (int)*p_i;
-  }
-  // int & gho_llint
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_LLINT) {
-    int* p_r = (int*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && llabs(*p_i) > INT_MAX / abs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(int, gho_llint) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= (int)*p_i;
-  }
-  #ifdef gho_with_gmp
-  // int & gho_mpz_t
-  else if (r.type == GHO_TYPE_INT && i.type == GHO_TYPE_GHO_MPZ_T) {
-    int* p_r = (int*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r != 0 && p_i != 0 && llabs(p_i) > INT_MAX / abs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(int, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= (int)p_i;
-  }
-  #endif
-  
-  // gho_lint & int
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_INT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && abs(*p_i) > LONG_MAX / labs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_lint, int) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= *p_i;
-  }
-  // gho_lint & gho_lint
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_LINT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && labs(*p_i) > LONG_MAX / labs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_lint, gho_lint) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= *p_i;
-  }
-  // gho_lint & gho_llint
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_LLINT) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && p_i != 0 && llabs(*p_i) > LONG_MAX / labs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_lint, gho_llint) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= (gho_lint)*p_i;
-  }
-  #ifdef gho_with_gmp
-  // gho_lint & gho_mpz_t
-  else if (r.type == GHO_TYPE_LINT && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_lint* p_r = (gho_lint*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r != 0 && p_i != 0 && llabs(p_i) > LONG_MAX / labs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_lint, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= (gho_lint)p_i;
-  }
-  #endif
-  
-  // gho_llint & int
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_INT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && abs(*p_i) > LLONG_MAX / llabs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_llint, int) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= *p_i;
-  }
-  // gho_llint & gho_lint
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_LINT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && labs(*p_i) > LLONG_MAX / llabs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_llint, gho_lint) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= *p_i;
+void gho_mul_lint_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_lint* p_r = (gho_lint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_lint tmp;
+  if (gho_lint_mul_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
   }
-  // gho_llint & gho_llint
-  else if (r.type == GHO_TYPE_LLINT && i.type == GHO_TYPE_LLINT) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_llint* const p_i = (gho_llint*)(i.p);
-    #ifndef NDEBUG
-    if (*p_r != 0 && *p_i != 0 && llabs(*p_i) > LLONG_MAX / llabs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_llint, gho_llint) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= *p_i;
+  else {
+    *p_r = tmp;
   }
-  #ifdef gho_with_gmp
-  // gho_llint & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_llint* p_r = (gho_llint*)(r.p);
-    const gho_llint p_i = gho_operand_to_lli(i);
-    #ifndef NDEBUG
-    if (*p_r != 0 && p_i != 0 && llabs(p_i) > LLONG_MAX / llabs(*p_r)) {
-      fprintf(stderr, "ERROR: gho_mul(gho_llint, gho_mpz_t) overflow!\n");
-      exit(1);
-    }
-    #endif
-    *p_r *= p_i;
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_llint and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_llint_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_llint* p_r = (gho_llint*)(r.p);
+  const gho_llint p_i = gho_operand_to_lli(i);
+  gho_llint tmp;
+  if (gho_llint_mul_overflow(*p_r, p_i, &tmp)) {
+    gho_operand_overflow_fct()("gho_mul", r, i);
   }
-  #endif
-  
-  #ifdef gho_with_gmp
-  // gho_mpz_t & int
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_INT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const int* const p_i = (int*)(i.p);
-    mpz_mul_si(p_r->i, p_r->i, *p_i);
+  else {
+    *p_r = tmp;
   }
-  // gho_mpz_t & gho_lint
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_LINT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint* const p_i = (gho_lint*)(i.p);
-    mpz_mul_si(p_r->i, p_r->i, *p_i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_mpz_t and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_mpz_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+  const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+  if (p_i->is_mpz) {
+    mpz_mul(p_r->i, p_r->i, p_i->i.big);
   }
-  // gho_mpz_t & gho_llint
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_LLINT) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint tmp_i = gho_operand_to_li(i);
-    mpz_mul_si(p_r->i, p_r->i, tmp_i);
+  else {
+    mpz_mul_si(p_r->i, p_r->i, p_i->i.small);
   }
-  // gho_mpz_t & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
-    mpz_mul(p_r->i, p_r->i, p_i->i);
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_smpz_t and i a int
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_smpz_int_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_mul_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_smpz_t and i a gho_lint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_smpz_lint_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_mul_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_smpz_t and i a gho_llint
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_smpz_llint_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_mul_li((gho_smpz_t*)(r.p), gho_operand_to_li(i));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_smpz_t and i a gho_mpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_smpz_mpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_mul_mpz((gho_smpz_t*)(r.p), (gho_mpz_t*)(i.p));
+}
+#endif
+
+#ifdef gho_with_gmp
+/**
+ * \brief r *= i with r a gho_smpz_t and i a gho_smpz_t
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \warning Do not use this function, use gho_mul
+ * @relates gho_operand_t
+ */
+void gho_mul_smpz_smpz_(gho_operand_t r, const gho_operand_t i) {
+  gho_smpz_t* p_r = (gho_smpz_t*)(r.p);
+  const gho_smpz_t* const p_i = (gho_smpz_t*)(i.p);
+  // Fast path: two gho_lint and no overflow
+  gho_lint tmp;
+  if (p_r->is_mpz == false && p_i->is_mpz == false &&
+      gho_lint_mul_overflow(p_r->i.small, p_i->i.small, &tmp) == false) {
+    p_r->i.small = tmp;
   }
-  #endif
-  
-  // Other
   else {
-    gho_operand_type_error_2("gho_mul", r, i);
+    gho_smpz_mul(p_r, p_i);
   }
 }
+#endif
+
+/**
+ * \brief r *= i
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * @relates gho_operand_t
+ */
+void gho_mul(gho_operand_t r, const gho_operand_t i) {
+  // Indexed by gho_operand_type_index_ (positional: C++ compatible)
+  static const gho_operand_binary_fct_t table[gho_operand_type_nb]
+                                               [gho_operand_type_nb] = {
+    { // r: int
+      gho_mul_int_int_,
+      gho_mul_int_lint_,
+      gho_mul_int_llint_,
+      gho_operand_gmp_fct_(gho_mul_int_mpz_),
+      gho_operand_gmp_fct_(gho_mul_int_smpz_)
+    },
+    { // r: gho_lint
+      gho_mul_lint_int_,
+      gho_mul_lint_lint_,
+      gho_mul_lint_llint_,
+      gho_operand_gmp_fct_(gho_mul_lint_mpz_),
+      gho_operand_gmp_fct_(gho_mul_lint_smpz_)
+    },
+    { // r: gho_llint
+      gho_mul_llint_int_,
+      gho_mul_llint_lint_,
+      gho_mul_llint_llint_,
+      gho_operand_gmp_fct_(gho_mul_llint_mpz_),
+      gho_operand_gmp_fct_(gho_mul_llint_smpz_)
+    },
+    { // r: gho_mpz_t
+      gho_operand_gmp_fct_(gho_mul_mpz_int_),
+      gho_operand_gmp_fct_(gho_mul_mpz_lint_),
+      gho_operand_gmp_fct_(gho_mul_mpz_llint_),
+      gho_operand_gmp_fct_(gho_mul_mpz_mpz_),
+      gho_operand_gmp_fct_(gho_mul_mpz_smpz_)
+    },
+    { // r: gho_smpz_t
+      gho_operand_gmp_fct_(gho_mul_smpz_int_),
+      gho_operand_gmp_fct_(gho_mul_smpz_lint_),
+      gho_operand_gmp_fct_(gho_mul_smpz_llint_),
+      gho_operand_gmp_fct_(gho_mul_smpz_mpz_),
+      gho_operand_gmp_fct_(gho_mul_smpz_smpz_)
+    }
+  };
+  gho_operand_binary_dispatch("gho_mul", table, r, i);
+}
 
 /**
  * \brief r /= i (exact division)
@@ -1081,7 +2168,7 @@ void gho_mod(gho_operand_t r, const gho_operand_t i) {
 }
 
 /**
- * \brief r = r ^ i (power)
+ * \brief r = r ^ i (power, exponentiation by squaring)
  * \param[in] r A gho_operand_t
  * \param[in] i A gho_operand_t
  * @relates gho_operand_t
@@ -1095,44 +2182,153 @@ void gho_pow(gho_operand_t r, const gho_operand_t i) {
   }
   #endif
   
-  // i == 0
-  if (gho_op_is_0(i)) {
-    gho_set_1(r);
-    return;
+  const gho_ullint e = (gho_ullint)gho_operand_to_lli(i);
+  
+  // int
+  if (r.type == GHO_TYPE_INT) {
+    int* p_r = (int*)(r.p);
+    int tmp;
+    if (gho_int_pow_overflow(*p_r, e, &tmp)) {
+      gho_operand_overflow_fct()("gho_pow", r, i);
+    }
+    else {
+      *p_r = tmp;
+    }
+  }
+  // gho_lint
+  else if (r.type == GHO_TYPE_LINT) {
+    gho_lint* p_r = (gho_lint*)(r.p);
+    gho_lint tmp;
+    if (gho_lint_pow_overflow(*p_r, e, &tmp)) {
+      gho_operand_overflow_fct()("gho_pow", r, i);
+    }
+    else {
+      *p_r = tmp;
+    }
+  }
+  // gho_llint
+  else if (r.type == GHO_TYPE_LLINT) {
+    gho_llint* p_r = (gho_llint*)(r.p);
+    gho_llint tmp;
+    if (gho_llint_pow_overflow(*p_r, e, &tmp)) {
+      gho_operand_overflow_fct()("gho_pow", r, i);
+    }
+    else {
+      *p_r = tmp;
+    }
   }
   
-  // i == 1
-  if (gho_op_is_0(i)) {
-    return;
+  #ifdef gho_with_gmp
+  // gho_mpz_t
+  else if (r.type == GHO_TYPE_GHO_MPZ_T) {
+    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
+    mpz_pow_ui(p_r->i, p_r->i, (gho_ulint)e);
   }
+  // gho_smpz_t (promoted to a mpz_t only if the result does not fit)
+  else if (r.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_pow_ui((gho_smpz_t*)(r.p), (gho_ulint)e);
+  }
+  #endif
   
-  // Not gho_mpz_t & *
-  if (r.type != GHO_TYPE_GHO_MPZ_T) {
-    const gho_llint tmp_r = gho_operand_to_lli(r);
-    const gho_llint tmp_i = gho_operand_to_lli(i);
-    for (gho_llint n = 0; n < tmp_i; ++n) {
-      gho_mul_lli(r, tmp_r);
+  // Other
+  else {
+    gho_operand_type_error_2("gho_pow", r, i);
+  }
+}
+
+/**
+ * \brief r = r ^ i modulo m (modular power, exponentiation by squaring)
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_operand_t
+ * \param[in] m A gho_operand_t
+ * \note The result is in [0, |m|)
+ * @relates gho_operand_t
+ */
+void gho_pow_mod(gho_operand_t r, const gho_operand_t i,
+                 const gho_operand_t m) {
+  
+  #ifndef NDEBUG
+  if (gho_op_is_negatif(i)) {
+    fprintf(stderr, "ERROR: gho_pow_mod(r, i, m): i can not be lesser than "
+                    "0!\n");
+    exit(1);
+  }
+  if (gho_op_is_0(m)) {
+    fprintf(stderr, "ERROR: gho_pow_mod(r, i, m): m can not be equal to 0!\n");
+    exit(1);
+  }
+  #endif
+  
+  const gho_ullint e = (gho_ullint)gho_operand_to_lli(i);
+  
+  // int
+  if (r.type == GHO_TYPE_INT) {
+    int* p_r = (int*)(r.p);
+    const gho_llint tmp = gho_llint_pow_mod(*p_r, e, gho_operand_to_lli(m));
+    if (tmp > INT_MAX) {
+      gho_operand_overflow_fct()("gho_pow_mod", r, i);
+    }
+    else {
+      *p_r = (int)tmp;
     }
   }
+  // gho_lint
+  else if (r.type == GHO_TYPE_LINT) {
+    gho_lint* p_r = (gho_lint*)(r.p);
+    const gho_llint tmp = gho_llint_pow_mod(*p_r, e, gho_operand_to_lli(m));
+    if (tmp > LONG_MAX) {
+      gho_operand_overflow_fct()("gho_pow_mod", r, i);
+    }
+    else {
+      *p_r = (gho_lint)tmp;
+    }
+  }
+  // gho_llint
+  else if (r.type == GHO_TYPE_LLINT) {
+    gho_llint* p_r = (gho_llint*)(r.p);
+    *p_r = gho_llint_pow_mod(*p_r, e, gho_operand_to_lli(m));
+  }
   
   #ifdef gho_with_gmp
-  // gho_mpz_t & not gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type != GHO_TYPE_GHO_MPZ_T) {
+  // gho_mpz_t
+  else if (r.type == GHO_TYPE_GHO_MPZ_T) {
     gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint tmp_i = gho_operand_to_li(i);
-    mpz_pow_ui(p_r->i, p_r->i, (gho_ulint)tmp_i);
+    gho_mpz_t tmp_m;
+    if (m.type == GHO_TYPE_GHO_MPZ_T) {
+      mpz_init_set(tmp_m.i, ((const gho_mpz_t*)(m.p))->i);
+    }
+    else if (m.type == GHO_TYPE_GHO_SMPZ_T) {
+      tmp_m = gho_smpz_to_mpz((const gho_smpz_t*)(m.p));
+    }
+    else {
+      mpz_init_set_si(tmp_m.i, gho_operand_to_li(m));
+    }
+    mpz_abs(tmp_m.i, tmp_m.i);
+    mpz_powm_ui(p_r->i, p_r->i, (gho_ulint)e, tmp_m.i);
+    gho_mpz_destroy(&tmp_m);
   }
-  // gho_mpz_t & gho_mpz_t
-  else if (r.type == GHO_TYPE_GHO_MPZ_T && i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_mpz_t* p_r = (gho_mpz_t*)(r.p);
-    const gho_lint tmp_i = gho_operand_to_li(i);
-    mpz_pow_ui(p_r->i, p_r->i, (gho_ulint)tmp_i);
+  // gho_smpz_t
+  else if (r.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_t* p_r = (gho_smpz_t*)(r.p);
+    if (m.type == GHO_TYPE_GHO_SMPZ_T) {
+      gho_smpz_pow_mod(p_r, (gho_ulint)e, (const gho_smpz_t*)(m.p));
+    }
+    else if (m.type == GHO_TYPE_GHO_MPZ_T) {
+      gho_smpz_t tmp_m =
+        gho_smpz_create_from_mpz((const gho_mpz_t*)(m.p));
+      gho_smpz_pow_mod(p_r, (gho_ulint)e, &tmp_m);
+      gho_smpz_destroy(&tmp_m);
+    }
+    else {
+      const gho_smpz_t tmp_m = gho_smpz_create_from_li(gho_operand_to_li(m));
+      gho_smpz_pow_mod(p_r, (gho_ulint)e, &tmp_m);
+    }
   }
   #endif
   
   // Other
   else {
-    gho_operand_type_error_2("gho_pow", r, i);
+    gho_operand_type_error_2("gho_pow_mod", r, i);
   }
 }
 
@@ -1140,10 +2336,32 @@ void gho_pow(gho_operand_t r, const gho_operand_t i) {
  * \brief r = greater_common_divisor(r, i)
  * \param[in] r A gho_operand_t
  * \param[in] i A gho_operand_t
+ * \warning When r is a machine integer, the gcd of the minimum of its type
+ *          with 0 or with itself does not fit: gcd(LLONG_MIN, 0) gives
+ *          LLONG_MIN, the smaller types are an overflow error (a negative
+ *          value with NDEBUG)
  * @relates gho_operand_t
  */
 void gho_gcd(gho_operand_t r, const gho_operand_t i) {
   
+  #ifdef gho_with_gmp
+  // gho_smpz_t & *
+  if (r.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_t* p_r = (gho_smpz_t*)(r.p);
+    if (i.type == GHO_TYPE_GHO_SMPZ_T) {
+      gho_smpz_gcd(p_r, (const gho_smpz_t*)(i.p));
+    }
+    else if (i.type == GHO_TYPE_GHO_MPZ_T) {
+      gho_smpz_promote_(p_r);
+      mpz_gcd(p_r->i.big, p_r->i.big, ((const gho_mpz_t*)(i.p))->i);
+    }
+    else {
+      gho_smpz_gcd_li(p_r, gho_operand_to_li(i));
+    }
+    return;
+  }
+  #endif
+  
   // Not gho_mpz_t & *
   if (r.type != GHO_TYPE_GHO_MPZ_T) {
     const gho_llint tmp_r = gho_operand_to_lli(r);
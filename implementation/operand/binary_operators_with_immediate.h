@@ -113,3 +113,17 @@ void gho_gcd_lli(gho_operand_t r, const gho_llint i) {
   gho_llint tmp = i;
   gho_gcd(r, gho_operand_type(&tmp, GHO_TYPE_LLINT));
 }
+
+/**
+ * \brief r = r ^ i modulo m (modular power)
+ * \param[in] r A gho_operand_t
+ * \param[in] i A gho_llint
+ * \param[in] m A gho_llint
+ * @relates gho_operand_t
+ */
+void gho_pow_mod_lli(gho_operand_t r, const gho_llint i, const gho_llint m) {
+  gho_llint tmp_i = i;
+  gho_llint tmp_m = m;
+  gho_pow_mod(r, gho_operand_type(&tmp_i, GHO_TYPE_LLINT),
+              gho_operand_type(&tmp_m, GHO_TYPE_LLINT));
+}
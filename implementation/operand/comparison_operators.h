@@ -174,6 +174,36 @@ bool gho_cop_equal(const gho_coperand_t a, const gho_coperand_t b) {
   else if (a.type == GHO_TYPE_GHO_MPZ_T && b.type == GHO_TYPE_GHO_MPZ_T) {
     return mpz_cmp((*(const gho_mpz_t*)(a.p)).i, (*(const gho_mpz_t*)(b.p)).i) == 0;
   }
+  
+  // gho_smpz_t & gho_smpz_t
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T && b.type == GHO_TYPE_GHO_SMPZ_T) {
+    return gho_smpz_compare((const gho_smpz_t*)(a.p),
+                            (const gho_smpz_t*)(b.p)) == 0;
+  }
+  // gho_smpz_t & gho_mpz_t
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T && b.type == GHO_TYPE_GHO_MPZ_T) {
+    return gho_smpz_compare_mpz((const gho_smpz_t*)(a.p),
+                                (const gho_mpz_t*)(b.p)) == 0;
+  }
+  // gho_mpz_t & gho_smpz_t
+  else if (a.type == GHO_TYPE_GHO_MPZ_T && b.type == GHO_TYPE_GHO_SMPZ_T) {
+    return gho_smpz_compare_mpz((const gho_smpz_t*)(b.p),
+                                (const gho_mpz_t*)(a.p)) == 0;
+  }
+  // gho_smpz_t & int, gho_lint, gho_llint
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T &&
+           (b.type == GHO_TYPE_INT || b.type == GHO_TYPE_LINT ||
+            b.type == GHO_TYPE_LLINT)) {
+    const gho_lint tmp = gho_coperand_to_li(b);
+    return gho_smpz_compare_li((const gho_smpz_t*)(a.p), tmp) == 0;
+  }
+  // int, gho_lint, gho_llint & gho_smpz_t
+  else if ((a.type == GHO_TYPE_INT || a.type == GHO_TYPE_LINT ||
+            a.type == GHO_TYPE_LLINT) &&
+           b.type == GHO_TYPE_GHO_SMPZ_T) {
+    const gho_lint tmp = gho_coperand_to_li(a);
+    return gho_smpz_compare_li((const gho_smpz_t*)(b.p), tmp) == 0;
+  }
   #endif
   
   // Other
@@ -279,6 +309,36 @@ bool gho_cop_lesser(const gho_coperand_t a, const gho_coperand_t b) {
   else if (a.type == GHO_TYPE_GHO_MPZ_T && b.type == GHO_TYPE_GHO_MPZ_T) {
     return mpz_cmp((*(const gho_mpz_t*)(a.p)).i, (*(const gho_mpz_t*)(b.p)).i) < 0;
   }
+  
+  // gho_smpz_t & gho_smpz_t
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T && b.type == GHO_TYPE_GHO_SMPZ_T) {
+    return gho_smpz_compare((const gho_smpz_t*)(a.p),
+                            (const gho_smpz_t*)(b.p)) < 0;
+  }
+  // gho_smpz_t & gho_mpz_t
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T && b.type == GHO_TYPE_GHO_MPZ_T) {
+    return gho_smpz_compare_mpz((const gho_smpz_t*)(a.p),
+                                (const gho_mpz_t*)(b.p)) < 0;
+  }
+  // gho_mpz_t & gho_smpz_t
+  else if (a.type == GHO_TYPE_GHO_MPZ_T && b.type == GHO_TYPE_GHO_SMPZ_T) {
+    return gho_smpz_compare_mpz((const gho_smpz_t*)(b.p),
+                                (const gho_mpz_t*)(a.p)) > 0;
+  }
+  // gho_smpz_t & int, gho_lint, gho_llint
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T &&
+           (b.type == GHO_TYPE_INT || b.type == GHO_TYPE_LINT ||
+            b.type == GHO_TYPE_LLINT)) {
+    const gho_lint tmp = gho_coperand_to_li(b);
+    return gho_smpz_compare_li((const gho_smpz_t*)(a.p), tmp) < 0;
+  }
+  // int, gho_lint, gho_llint & gho_smpz_t
+  else if ((a.type == GHO_TYPE_INT || a.type == GHO_TYPE_LINT ||
+            a.type == GHO_TYPE_LLINT) &&
+           b.type == GHO_TYPE_GHO_SMPZ_T) {
+    const gho_lint tmp = gho_coperand_to_li(a);
+    return gho_smpz_compare_li((const gho_smpz_t*)(b.p), tmp) > 0;
+  }
   #endif
   
   // Other
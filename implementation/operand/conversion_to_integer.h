@@ -86,6 +86,10 @@ gho_llint gho_coperand_to_lli(gho_coperand_t i) {
     #endif
     return mpz_get_si(((const gho_mpz_t*)(i.p))->i);
   }
+  // gho_smpz_t
+  else if (i.type == GHO_TYPE_GHO_SMPZ_T) {
+    return gho_smpz_get_li((const gho_smpz_t*)(i.p));
+  }
   #endif
   
   // Other
@@ -139,6 +143,10 @@ gho_lint gho_coperand_to_li(gho_coperand_t i) {
     #endif
     return mpz_get_si(((const gho_mpz_t*)(i.p))->i);
   }
+  // gho_smpz_t
+  else if (i.type == GHO_TYPE_GHO_SMPZ_T) {
+    return gho_smpz_get_li((const gho_smpz_t*)(i.p));
+  }
   #endif
   
   // Other
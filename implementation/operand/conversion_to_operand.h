@@ -14,10 +14,12 @@
 
 
 #include "../../vector/int.h"
+#include "../../vector/smpz_t.h"
 #include "../../matrix/int.h"
 #include "../../matrix/lint.h"
 #include "../../matrix/llint.h"
 #include "../../matrix/mpz_t.h"
+#include "../../matrix/smpz_t.h"
 
 
 // Conversion to gho_operand_t
@@ -60,6 +62,13 @@ gho_operand_t gho_operand_i(void* p, const size_t i) {
     r.p = &((gho_vector_int_t*)p)->array[i];
   }
   
+  #ifdef gho_with_gmp
+  else if (r.type == GHO_TYPE_VECTOR_SMPZ_T) {
+    r.type = GHO_TYPE_GHO_SMPZ_T;
+    r.p = &((gho_vector_smpz_t*)p)->array[i];
+  }
+  #endif
+  
   // Other
   else {
     gho_operand_type_error_1("gho_operand_i", r);
@@ -100,6 +109,11 @@ gho_operand_t gho_operand_i_j(void* p, const size_t i, const size_t j) {
     r.type = GHO_TYPE_GHO_MPZ_T;
     r.p = &((gho_matrix_mpz_t*)p)->array[i][j];
   }
+  
+  else if (r.type == GHO_TYPE_MATRIX_SMPZ_T) {
+    r.type = GHO_TYPE_GHO_SMPZ_T;
+    r.p = &((gho_matrix_smpz_t*)p)->array[i][j];
+  }
   #endif
   
   // Other
@@ -150,6 +164,13 @@ gho_coperand_t gho_coperand_i(const void* p, const size_t i) {
     r.p = &((const gho_vector_int_t*)p)->array[i];
   }
   
+  #ifdef gho_with_gmp
+  else if (r.type == GHO_TYPE_VECTOR_SMPZ_T) {
+    r.type = GHO_TYPE_GHO_SMPZ_T;
+    r.p = &((const gho_vector_smpz_t*)p)->array[i];
+  }
+  #endif
+  
   // Other
   else {
     gho_coperand_type_error_1("gho_coperand_i", r);
@@ -190,6 +211,11 @@ gho_coperand_t gho_coperand_i_j(const void* p, const size_t i, const size_t j) {
     r.type = GHO_TYPE_GHO_MPZ_T;
     r.p = &((const gho_matrix_mpz_t*)p)->array[i][j];
   }
+  
+  else if (r.type == GHO_TYPE_MATRIX_SMPZ_T) {
+    r.type = GHO_TYPE_GHO_SMPZ_T;
+    r.p = &((const gho_matrix_smpz_t*)p)->array[i][j];
+  }
   #endif
   
   // Other
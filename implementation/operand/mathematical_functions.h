@@ -67,7 +67,7 @@ void gho_ceil(gho_operand_t i) {
 }
 
 /**
- * \brief i = log2(i)
+ * \brief i = log2(i) (number of digits of |i| in base 2, 1 for 0)
  * \param[in] i A gho_operand_t
  * @relates gho_operand_t
  */
@@ -91,9 +91,18 @@ void gho_log2(gho_operand_t i) {
   #ifdef gho_with_gmp
   // gho_mpz_t
   else if (i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_mpz_t tmp = gho_mpz_log2(*(gho_mpz_t*)(i.p));
-    gho_T_swap(gho_mpz_t, tmp, *(gho_mpz_t*)(i.p));
-    gho_mpz_destroy(&tmp);
+    gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
+    mpz_set_ui(p_i->i, (gho_ulint)mpz_sizeinbase(p_i->i, 2));
+  }
+  // gho_smpz_t
+  else if (i.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_t* p_i = (gho_smpz_t*)(i.p);
+    if (p_i->is_mpz) {
+      gho_smpz_set_li(p_i, (gho_lint)mpz_sizeinbase(p_i->i.big, 2));
+    }
+    else {
+      p_i->i.small = gho_lint_log2(p_i->i.small);
+    }
   }
   #endif
   
@@ -104,7 +113,7 @@ void gho_log2(gho_operand_t i) {
 }
 
 /**
- * \brief i = log10(i)
+ * \brief i = log10(i) (number of digits of |i| in base 10, 1 for 0)
  * \param[in] i A gho_operand_t
  * @relates gho_operand_t
  */
@@ -128,37 +137,158 @@ void gho_log10(gho_operand_t i) {
   #ifdef gho_with_gmp
   // gho_mpz_t
   else if (i.type == GHO_TYPE_GHO_MPZ_T) {
-    gho_mpz_t tmp = gho_mpz_log10(*(gho_mpz_t*)(i.p));
-    gho_T_swap(gho_mpz_t, tmp, *(gho_mpz_t*)(i.p));
-    gho_mpz_destroy(&tmp);
+    gho_mpz_t* p_i = (gho_mpz_t*)(i.p);
+    mpz_set_ui(p_i->i, (gho_ulint)gho_mpz_log10_(p_i->i));
+  }
+  // gho_smpz_t
+  else if (i.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_t* p_i = (gho_smpz_t*)(i.p);
+    if (p_i->is_mpz) {
+      gho_smpz_set_li(p_i, (gho_lint)gho_mpz_log10_(p_i->i.big));
+    }
+    else {
+      p_i->i.small = gho_lint_log10(p_i->i.small);
+    }
   }
   #endif
   
   // Other
   else {
-    gho_operand_type_error_1("gho_log2", i);
+    gho_operand_type_error_1("gho_log10", i);
   }
 }
 
 /**
- * \brief i = pow_10_floor(i)
+ * \brief i = pow_10_floor(i) (greatest power of 10 <= |i|, with the sign of i)
  * \param[in] i A gho_operand_t
  * @relates gho_operand_t
  */
 void gho_pow_10_floor(gho_operand_t i) {
-  // http://ubuntuforums.org/showthread.php?t=816175&s=2917e9d0741387015eda91408727af19&p=5099702#post5099702
-  gho_operand_type_error_1("gho_pow_10_floor", i);
+  gho_pow_10_(i, false);
 }
 
 /**
- * \brief i = pow_10_round(i)
+ * \brief i = pow_10_round(i) (power of 10 nearest to |i|, with the sign of i)
  * \param[in] i A gho_operand_t
  * @relates gho_operand_t
  */
 void gho_pow_10_round(gho_operand_t i) {
-  // http://ubuntuforums.org/showthread.php?t=816175&s=2917e9d0741387015eda91408727af19&p=5099702#post5099702
-  gho_operand_type_error_1("gho_pow_10_round", i);
-//   gho_log10(i);
-//   gho_floor(i);
-//   gho_set_lli(i, pow(10, gho_operand_to_size_t(i)));
+  gho_pow_10_(i, true);
+}
+
+/**
+ * \brief i = pow_10_floor(i) or i = pow_10_round(i)
+ * \param[in] i     A gho_operand_t
+ * \param[in] round true for pow_10_round, false for pow_10_floor
+ * \warning Do not use this function, use gho_pow_10_floor or gho_pow_10_round
+ * @relates gho_operand_t
+ */
+void gho_pow_10_(gho_operand_t i, const bool round) {
+  
+  const char* const function_name =
+    round ? "gho_pow_10_round" : "gho_pow_10_floor";
+  
+  #ifdef gho_with_gmp
+  // gho_mpz_t
+  if (i.type == GHO_TYPE_GHO_MPZ_T) {
+    gho_mpz_pow_10_(((gho_mpz_t*)(i.p))->i, round);
+    return;
+  }
+  // gho_smpz_t (a big result is promoted)
+  if (i.type == GHO_TYPE_GHO_SMPZ_T && ((gho_smpz_t*)(i.p))->is_mpz) {
+    gho_mpz_pow_10_(((gho_smpz_t*)(i.p))->i.big, round);
+    return;
+  }
+  #endif
+  
+  if (i.type != GHO_TYPE_INT && i.type != GHO_TYPE_LINT &&
+      i.type != GHO_TYPE_LLINT
+      #ifdef gho_with_gmp
+      && i.type != GHO_TYPE_GHO_SMPZ_T
+      #endif
+     ) {
+    gho_operand_type_error_1(function_name, i);
+    return;
+  }
+  
+  // Machine integers: |i| as a gho_ullint
+  const gho_llint v = gho_operand_to_lli(i);
+  const gho_ullint v_abs = (v < 0) ? -(gho_ullint)v : (gho_ullint)v;
+  const gho_ullint r_abs =
+    round ? gho_ullint_pow_10_round(v_abs) : gho_ullint_pow_10_floor(v_abs);
+  
+  // int
+  if (i.type == GHO_TYPE_INT) {
+    if (r_abs > INT_MAX) {
+      gho_operand_overflow_fct()(function_name, i, i);
+    }
+    else {
+      *(int*)(i.p) = (v < 0) ? -(int)r_abs : (int)r_abs;
+    }
+  }
+  // gho_lint
+  else if (i.type == GHO_TYPE_LINT) {
+    if (r_abs > LONG_MAX) {
+      gho_operand_overflow_fct()(function_name, i, i);
+    }
+    else {
+      *(gho_lint*)(i.p) = (v < 0) ? -(gho_lint)r_abs : (gho_lint)r_abs;
+    }
+  }
+  // gho_llint
+  else if (i.type == GHO_TYPE_LLINT) {
+    if (r_abs > LLONG_MAX) {
+      gho_operand_overflow_fct()(function_name, i, i);
+    }
+    else {
+      *(gho_llint*)(i.p) = (v < 0) ? -(gho_llint)r_abs : (gho_llint)r_abs;
+    }
+  }
+  #ifdef gho_with_gmp
+  // gho_smpz_t
+  else {
+    gho_smpz_t* p_i = (gho_smpz_t*)(i.p);
+    if (r_abs <= LONG_MAX) {
+      p_i->i.small = (v < 0) ? -(gho_lint)r_abs : (gho_lint)r_abs;
+    }
+    else {
+      gho_smpz_promote_(p_i);
+      mpz_set_ui(p_i->i.big, r_abs);
+      if (v < 0) { mpz_neg(p_i->i.big, p_i->i.big); }
+    }
+  }
+  #endif
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief i = pow_10_floor(i) or i = pow_10_round(i)
+ * \param[in] i     A mpz_t
+ * \param[in] round true for pow_10_round, false for pow_10_floor
+ * \warning Do not use this function, use gho_pow_10_floor or gho_pow_10_round
+ * @relates gho_operand_t
+ */
+void gho_mpz_pow_10_(mpz_t i, const bool round) {
+  const int sign = mpz_sgn(i);
+  if (sign == 0) { return; }
+  const size_t n = gho_mpz_log10_(i);
+  mpz_t floor;
+  mpz_init(floor);
+  mpz_ui_pow_ui(floor, 10, (gho_ulint)(n - 1));
+  if (round) {
+    // |i| - 10^(n-1) >= 10^n - |i| <=> 2 |i| >= 11 * 10^(n-1)
+    mpz_t twice;
+    mpz_init(twice);
+    mpz_mul_2exp(twice, i, 1);
+    mpz_abs(twice, twice);
+    mpz_mul_ui(floor, floor, 11);
+    const bool up = (mpz_cmp(twice, floor) >= 0);
+    mpz_divexact_ui(floor, floor, 11);
+    if (up) { mpz_mul_ui(floor, floor, 10); }
+    mpz_clear(twice);
+  }
+  mpz_swap(i, floor);
+  if (sign < 0) { mpz_neg(i, i); }
+  mpz_clear(floor);
 }
+#endif
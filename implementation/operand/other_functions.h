@@ -45,6 +45,10 @@ void gho_op_swap(const gho_operand_t a, const gho_operand_t b) {
   else if (a.type == GHO_TYPE_GHO_MPZ_T && b.type == GHO_TYPE_GHO_MPZ_T) {
     gho_mpz_swap((gho_mpz_t*)(a.p), (gho_mpz_t*)(b.p));
   }
+  // gho_smpz_t & gho_smpz_t
+  else if (a.type == GHO_TYPE_GHO_SMPZ_T && b.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_swap((gho_smpz_t*)(a.p), (gho_smpz_t*)(b.p));
+  }
   #endif
   
   // Other
@@ -54,18 +58,26 @@ void gho_op_swap(const gho_operand_t a, const gho_operand_t b) {
 }
 
 /**
- * \brief a % b == 0
+ * \brief a % b == 0 (only 0 is divisible by 0)
  * \param[in] a A gho_operand_t
  * \param[in] b A gho_operand_t
  * \return a % b == 0
  * @relates gho_operand_t
  */
 bool gho_op_is_divisible(const gho_operand_t a, const gho_operand_t b) {
-  gho_operand_t copy = gho_operand_copy(&a);
-  gho_floor_div_r(copy, b);
-  const bool r = gho_op_is_0(copy);
-  gho_operand_destroy(&copy);
-  return r;
+  return gho_cop_is_divisible(gho_coperand_type(a.p, a.type),
+                              gho_coperand_type(b.p, b.type));
+}
+
+/**
+ * \brief a % b == 0 (only 0 is divisible by 0)
+ * \param[in] a A gho_operand_t
+ * \param[in] b A gho_llint
+ * \return a % b == 0
+ * @relates gho_operand_t
+ */
+bool gho_op_is_divisible_lli(const gho_operand_t a, const gho_llint b) {
+  return gho_cop_is_divisible_lli(gho_coperand_type(a.p, a.type), b);
 }
 
 /**
@@ -93,16 +105,106 @@ size_t gho_op_size_in_base_10(gho_operand_t i) {
 // gho_coperand_t
 
 /**
- * \brief a % b == 0
+ * \brief a % b == 0 (only 0 is divisible by 0)
  * \param[in] a A gho_coperand_t
  * \param[in] b A gho_coperand_t
  * \return a % b == 0
+ * \note No memory is allocated, GMP values are tested with mpz_divisible_p
  * @relates gho_coperand_t
  */
 bool gho_cop_is_divisible(const gho_coperand_t a, const gho_coperand_t b) {
-  // TODO
-  gho_coperand_type_error_2("gho_cop_is_divisible", a, b); return 0;
+  
+  if (gho_coperand_is_integer_(a) == false ||
+      gho_coperand_is_integer_(b) == false) {
+    gho_coperand_type_error_2("gho_cop_is_divisible", a, b); return false;
+  }
+  
+  #ifdef gho_with_gmp
+  const mpz_srcptr a_big = gho_coperand_mpz_(a);
+  const mpz_srcptr b_big = gho_coperand_mpz_(b);
+  // b is a machine integer
+  if (b_big == NULL) {
+    return gho_cop_is_divisible_lli(a, gho_coperand_to_lli(b));
+  }
+  // a and b are mpz_t
+  if (a_big != NULL) {
+    return mpz_divisible_p(a_big, b_big) != 0;
+  }
+  // a is a machine integer, b is a mpz_t
+  const gho_llint a_lli = gho_coperand_to_lli(a);
+  if (mpz_fits_slong_p(b_big)) {
+    return gho_llint_is_divisible(a_lli, mpz_get_si(b_big));
+  }
+  // |b| > LONG_MAX and |a| <= |LLONG_MIN|
+  const gho_ulint a_abs = (a_lli < 0) ? -(gho_ulint)a_lli : (gho_ulint)a_lli;
+  return a_abs == 0 || mpz_cmpabs_ui(b_big, a_abs) == 0;
+  #else
+  return gho_llint_is_divisible(gho_coperand_to_lli(a),
+                                gho_coperand_to_lli(b));
+  #endif
+}
+
+/**
+ * \brief a % b == 0 (only 0 is divisible by 0)
+ * \param[in] a A gho_coperand_t
+ * \param[in] b A gho_llint
+ * \return a % b == 0
+ * \note No memory is allocated, GMP values are tested with mpz_divisible_ui_p
+ * @relates gho_coperand_t
+ */
+bool gho_cop_is_divisible_lli(const gho_coperand_t a, const gho_llint b) {
+  
+  if (gho_coperand_is_integer_(a) == false) {
+    gho_coperand_type_error_1("gho_cop_is_divisible_lli", a); return false;
+  }
+  
+  #ifdef gho_with_gmp
+  const mpz_srcptr a_big = gho_coperand_mpz_(a);
+  if (a_big != NULL) {
+    const gho_ulint b_abs = (b < 0) ? -(gho_ulint)b : (gho_ulint)b;
+    return mpz_divisible_ui_p(a_big, b_abs) != 0;
+  }
+  #endif
+  
+  return gho_llint_is_divisible(gho_coperand_to_lli(a), b);
+}
+
+/**
+ * \brief Return true if i is an integer (int, gho_lint, gho_llint, gho_mpz_t
+ *        or gho_smpz_t)
+ * \param[in] i A gho_coperand_t
+ * \return true if i is an integer
+ * \warning Do not use this function, it is used by gho_cop_is_divisible
+ * @relates gho_coperand_t
+ */
+bool gho_coperand_is_integer_(const gho_coperand_t i) {
+  return i.type == GHO_TYPE_INT || i.type == GHO_TYPE_LINT ||
+         i.type == GHO_TYPE_LLINT
+         #ifdef gho_with_gmp
+         || i.type == GHO_TYPE_GHO_MPZ_T || i.type == GHO_TYPE_GHO_SMPZ_T
+         #endif
+         ;
+}
+
+#ifdef gho_with_gmp
+/**
+ * \brief Return the mpz_t of i, NULL if i is stored in a machine integer
+ * \param[in] i A gho_coperand_t
+ * \return the mpz_t of a gho_mpz_t or of a gho_smpz_t stored in a mpz_t, NULL
+ *         otherwise
+ * \warning Do not use this function, it is used by gho_cop_is_divisible
+ * @relates gho_coperand_t
+ */
+mpz_srcptr gho_coperand_mpz_(const gho_coperand_t i) {
+  if (i.type == GHO_TYPE_GHO_MPZ_T) {
+    return ((const gho_mpz_t*)(i.p))->i;
+  }
+  if (i.type == GHO_TYPE_GHO_SMPZ_T && ((const gho_smpz_t*)(i.p))->is_mpz) {
+    return ((const gho_smpz_t*)(i.p))->i.big;
+  }
+  return NULL;
 }
+#endif
 
 /**
  * \brief Return the size in base 2 of i
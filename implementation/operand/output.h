@@ -104,6 +104,10 @@ void gho_coperand_fprinti(FILE* file, const gho_coperand_t* const cop,
   else if (cop->type == GHO_TYPE_GHO_MPZ_T) {
     gho_mpz_fprinti(file, (const gho_mpz_t*)(cop->p), indent);
   }
+  // gho_smpz_t
+  else if (cop->type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_fprinti(file, (const gho_smpz_t*)(cop->p), indent);
+  }
   #endif
   
   // Other
@@ -160,6 +164,10 @@ void gho_coperand_sprinti(char** c_str, const gho_coperand_t* const cop,
   else if (cop->type == GHO_TYPE_GHO_MPZ_T) {
     gho_mpz_sprinti(c_str, (const gho_mpz_t*)(cop->p), indent);
   }
+  // gho_smpz_t
+  else if (cop->type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_sprinti(c_str, (const gho_smpz_t*)(cop->p), indent);
+  }
   #endif
   
   // Other
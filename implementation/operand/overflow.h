@@ -0,0 +1,88 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// Overflow
+
+static inline
+gho_operand_overflow_fct_t* gho_operand_overflow_fct_();
+
+#ifndef gho_with_local_overflow_fct
+  extern gho_operand_overflow_fct_t gho_operand_overflow_fct_global_;
+  #if defined(gho_global_overflow_fct_implementation)
+    /// \brief Overflow function shared by the files
+    gho_operand_overflow_fct_t gho_operand_overflow_fct_global_ =
+      gho_operand_overflow_error;
+  #elif (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+    // One definition by file, the linker keeps one of them
+    __attribute__((weak))
+    gho_operand_overflow_fct_t gho_operand_overflow_fct_global_ =
+      gho_operand_overflow_error;
+  #endif
+#endif
+
+/**
+ * \brief Return the storage of the overflow function
+ * \return a pointer on the overflow function
+ * \warning Do not use this function, use gho_operand_overflow_fct and
+ *          gho_operand_set_overflow_fct
+ */
+gho_operand_overflow_fct_t* gho_operand_overflow_fct_() {
+  #ifndef gho_with_local_overflow_fct
+    return &gho_operand_overflow_fct_global_;
+  #else
+    static gho_operand_overflow_fct_t fct = gho_operand_overflow_error;
+    return &fct;
+  #endif
+}
+
+/**
+ * \brief Set the function called when an operator overflows
+ * \param[in] fct A gho_operand_overflow_fct_t (gho_operand_overflow_error by
+ *                default)
+ * \warning The function is shared by the threads: set it before starting
+ *          them
+ * @relates gho_operand_t
+ */
+void gho_operand_set_overflow_fct(const gho_operand_overflow_fct_t fct) {
+  *gho_operand_overflow_fct_() = fct;
+}
+
+/**
+ * \brief Return the function called when gho_add, gho_sub or gho_mul
+ *        overflows
+ * \return the current gho_operand_overflow_fct_t
+ * @relates gho_operand_t
+ */
+gho_operand_overflow_fct_t gho_operand_overflow_fct() {
+  return *gho_operand_overflow_fct_();
+}
+
+/**
+ * \brief Default overflow function: display an error and exit
+ * \param[in] function_name Name of the function
+ * \param[in] r             The gho_operand_t r before the operation
+ * \param[in] i             The gho_operand_t i
+ * @relates gho_operand_t
+ */
+void gho_operand_overflow_error(const char* const function_name,
+                                const gho_operand_t r, const gho_operand_t i) {
+  fprintf(stderr, "ERROR: %s overflow for types (%i, %i)!\n",
+                  function_name, r.type, i.type);
+  exit(1);
+}
@@ -60,6 +60,10 @@ void gho_oppose(gho_operand_t i) {
   else if (i.type == GHO_TYPE_GHO_MPZ_T) {
     mpz_neg(((gho_mpz_t*)(i.p))->i, ((gho_mpz_t*)(i.p))->i);
   }
+  // gho_smpz_t
+  else if (i.type == GHO_TYPE_GHO_SMPZ_T) {
+    gho_smpz_neg((gho_smpz_t*)(i.p));
+  }
   #endif
   
   // Other
@@ -14,7 +14,9 @@
 
 
 #include <stddef.h>
+#include <string.h>
 
+#include "../memory.h"
 #include "../c_str.h"
 
 
@@ -35,5 +37,8 @@ void gho_fprinti(FILE* file, const unsigned int indent) {
  * @ingroup gho_input_output
  */
 void gho_sprinti(char** c_str, const unsigned int indent) {
-  for (size_t i = 0; i < indent; ++i) { gho_c_str_add_char(c_str, ' '); }
+  const size_t size_old = gho_c_str_size(*c_str);
+  gho_array_realloc(*c_str, char, size_old + indent + 1);
+  memset(*c_str + size_old, ' ', indent);
+  (*c_str)[size_old + indent] = '\0';
 }
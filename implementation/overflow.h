@@ -0,0 +1,325 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <limits.h>
+
+
+#ifndef gho_with_builtin_overflow
+
+// Portable versions: the operation is done on gho_llint after checking that
+// it does not overflow, then the result is checked against the bounds of the
+// result type
+
+static inline
+bool gho_llint_add_overflow_(const gho_llint a, const gho_llint b,
+                             gho_llint* r);
+static inline
+bool gho_llint_sub_overflow_(const gho_llint a, const gho_llint b,
+                             gho_llint* r);
+static inline
+bool gho_llint_mul_overflow_(const gho_llint a, const gho_llint b,
+                             gho_llint* r);
+
+/**
+ * \brief r = a + b on gho_llint without undefined behavior
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a + b overflows
+ * \warning Do not use this function, use gho_llint_add_overflow
+ * @ingroup gho_overflow
+ */
+bool gho_llint_add_overflow_(const gho_llint a, const gho_llint b,
+                             gho_llint* r) {
+  *r = (gho_llint)((gho_ullint)a + (gho_ullint)b);
+  return (b > 0 && a > LLONG_MAX - b) || (b < 0 && a < LLONG_MIN - b);
+}
+
+/**
+ * \brief r = a - b on gho_llint without undefined behavior
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a - b overflows
+ * \warning Do not use this function, use gho_llint_sub_overflow
+ * @ingroup gho_overflow
+ */
+bool gho_llint_sub_overflow_(const gho_llint a, const gho_llint b,
+                             gho_llint* r) {
+  *r = (gho_llint)((gho_ullint)a - (gho_ullint)b);
+  return (b < 0 && a > LLONG_MAX + b) || (b > 0 && a < LLONG_MIN + b);
+}
+
+/**
+ * \brief r = a * b on gho_llint without undefined behavior
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a * b overflows
+ * \warning Do not use this function, use gho_llint_mul_overflow
+ * @ingroup gho_overflow
+ */
+bool gho_llint_mul_overflow_(const gho_llint a, const gho_llint b,
+                             gho_llint* r) {
+  *r = (gho_llint)((gho_ullint)a * (gho_ullint)b);
+  if (a > 0) {
+    return (b > 0) ? (a > LLONG_MAX / b) : (b < LLONG_MIN / a);
+  }
+  else if (a < 0) {
+    return (b > 0) ? (a < LLONG_MIN / b) : (b != 0 && b < LLONG_MAX / a);
+  }
+  return false;
+}
+
+#endif
+
+// int
+
+/**
+ * \brief r = a + b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a + b does not fit in a int
+ * @ingroup gho_overflow
+ */
+bool gho_int_add_overflow(const gho_llint a, const gho_llint b, int* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_add_overflow(a, b, r);
+  #else
+    gho_llint tmp;
+    const bool overflow = gho_llint_add_overflow_(a, b, &tmp);
+    *r = (int)tmp;
+    return overflow || tmp < INT_MIN || tmp > INT_MAX;
+  #endif
+}
+
+/**
+ * \brief r = a - b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a - b does not fit in a int
+ * @ingroup gho_overflow
+ */
+bool gho_int_sub_overflow(const gho_llint a, const gho_llint b, int* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_sub_overflow(a, b, r);
+  #else
+    gho_llint tmp;
+    const bool overflow = gho_llint_sub_overflow_(a, b, &tmp);
+    *r = (int)tmp;
+    return overflow || tmp < INT_MIN || tmp > INT_MAX;
+  #endif
+}
+
+/**
+ * \brief r = a * b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a * b does not fit in a int
+ * @ingroup gho_overflow
+ */
+bool gho_int_mul_overflow(const gho_llint a, const gho_llint b, int* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_mul_overflow(a, b, r);
+  #else
+    gho_llint tmp;
+    const bool overflow = gho_llint_mul_overflow_(a, b, &tmp);
+    *r = (int)tmp;
+    return overflow || tmp < INT_MIN || tmp > INT_MAX;
+  #endif
+}
+
+/**
+ * \brief r = a ^ e, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  e A gho_ullint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a ^ e does not fit in a int
+ * @ingroup gho_overflow
+ */
+bool gho_int_pow_overflow(const gho_llint a, const gho_ullint e, int* r) {
+  gho_llint tmp;
+  const bool overflow = gho_llint_pow_overflow(a, e, &tmp);
+  *r = (int)tmp;
+  return overflow || tmp < INT_MIN || tmp > INT_MAX;
+}
+
+// gho_lint
+
+/**
+ * \brief r = a + b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a + b does not fit in a gho_lint
+ * @ingroup gho_overflow
+ */
+bool gho_lint_add_overflow(const gho_llint a, const gho_llint b, gho_lint* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_add_overflow(a, b, r);
+  #else
+    gho_llint tmp;
+    const bool overflow = gho_llint_add_overflow_(a, b, &tmp);
+    *r = (gho_lint)tmp;
+    return overflow || tmp < LONG_MIN || tmp > LONG_MAX;
+  #endif
+}
+
+/**
+ * \brief r = a - b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a - b does not fit in a gho_lint
+ * @ingroup gho_overflow
+ */
+bool gho_lint_sub_overflow(const gho_llint a, const gho_llint b, gho_lint* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_sub_overflow(a, b, r);
+  #else
+    gho_llint tmp;
+    const bool overflow = gho_llint_sub_overflow_(a, b, &tmp);
+    *r = (gho_lint)tmp;
+    return overflow || tmp < LONG_MIN || tmp > LONG_MAX;
+  #endif
+}
+
+/**
+ * \brief r = a * b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a * b does not fit in a gho_lint
+ * @ingroup gho_overflow
+ */
+bool gho_lint_mul_overflow(const gho_llint a, const gho_llint b, gho_lint* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_mul_overflow(a, b, r);
+  #else
+    gho_llint tmp;
+    const bool overflow = gho_llint_mul_overflow_(a, b, &tmp);
+    *r = (gho_lint)tmp;
+    return overflow || tmp < LONG_MIN || tmp > LONG_MAX;
+  #endif
+}
+
+/**
+ * \brief r = a ^ e, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  e A gho_ullint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a ^ e does not fit in a gho_lint
+ * @ingroup gho_overflow
+ */
+bool gho_lint_pow_overflow(const gho_llint a, const gho_ullint e,
+                           gho_lint* r) {
+  gho_llint tmp;
+  const bool overflow = gho_llint_pow_overflow(a, e, &tmp);
+  *r = (gho_lint)tmp;
+  return overflow || tmp < LONG_MIN || tmp > LONG_MAX;
+}
+
+// gho_llint
+
+/**
+ * \brief r = a + b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a + b does not fit in a gho_llint
+ * @ingroup gho_overflow
+ */
+bool gho_llint_add_overflow(const gho_llint a, const gho_llint b,
+                            gho_llint* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_add_overflow(a, b, r);
+  #else
+    return gho_llint_add_overflow_(a, b, r);
+  #endif
+}
+
+/**
+ * \brief r = a - b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a - b does not fit in a gho_llint
+ * @ingroup gho_overflow
+ */
+bool gho_llint_sub_overflow(const gho_llint a, const gho_llint b,
+                            gho_llint* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_sub_overflow(a, b, r);
+  #else
+    return gho_llint_sub_overflow_(a, b, r);
+  #endif
+}
+
+/**
+ * \brief r = a * b, with overflow detection
+ * \param[in]  a A gho_llint
+ * \param[in]  b A gho_llint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a * b does not fit in a gho_llint
+ * @ingroup gho_overflow
+ */
+bool gho_llint_mul_overflow(const gho_llint a, const gho_llint b,
+                            gho_llint* r) {
+  #ifdef gho_with_builtin_overflow
+    return __builtin_mul_overflow(a, b, r);
+  #else
+    return gho_llint_mul_overflow_(a, b, r);
+  #endif
+}
+
+/**
+ * \brief r = a ^ e, with overflow detection (exponentiation by squaring)
+ * \param[in]  a A gho_llint
+ * \param[in]  e A gho_ullint
+ * \param[out] r The result, modulo 2^n if there is an overflow
+ * \return true if a ^ e does not fit in a gho_llint
+ * @ingroup gho_overflow
+ */
+bool gho_llint_pow_overflow(const gho_llint a, const gho_ullint e,
+                            gho_llint* r) {
+  // The result modulo 2^n is computed on gho_ullint, the checked result on
+  // gho_llint until the first overflow
+  gho_ullint result_wrap = 1;
+  gho_ullint base_wrap = (gho_ullint)a;
+  gho_llint result = 1;
+  gho_llint base = a;
+  bool overflow = false;
+  for (gho_ullint n = e; n != 0; n >>= 1) {
+    if (n & 1) {
+      result_wrap *= base_wrap;
+      if (overflow == false) {
+        overflow = gho_llint_mul_overflow(result, base, &result);
+      }
+    }
+    // The base squared is always multiplied with the result after (the last
+    // bit of n is 1), so if the square overflows, the result overflows
+    if (n > 1) {
+      base_wrap *= base_wrap;
+      if (overflow == false) {
+        overflow = gho_llint_mul_overflow(base, base, &base);
+      }
+    }
+  }
+  *r = (gho_llint)result_wrap;
+  return overflow;
+}
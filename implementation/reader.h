@@ -0,0 +1,263 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "../memory.h"
+
+
+// Create & destroy
+
+/**
+ * \brief Return a new gho_reader_t on a C file
+ * \param[in] file A C file
+ * \return a new gho_reader_t
+ * \note The file is not closed by gho_reader_destroy
+ * @relates gho_reader_t
+ */
+gho_reader_t gho_reader_create(FILE* file) {
+  gho_reader_t reader;
+  reader.file = file;
+  reader.data = gho_array_alloc(char, 1);
+  reader.data[0] = '\0';
+  reader.begin = 0;
+  reader.end = 0;
+  reader.capacity = 0;
+  reader.eof = false;
+  return reader;
+}
+
+/**
+ * \brief Destroy a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \warning The chars read in advance in the buffer are lost for the file
+ * @relates gho_reader_t
+ */
+void gho_reader_destroy(gho_reader_t* reader) {
+  gho_free(reader->data); reader->data = NULL;
+  reader->file = NULL;
+  reader->begin = 0;
+  reader->end = 0;
+  reader->capacity = 0;
+}
+
+// Size
+
+/**
+ * \brief Return the number of chars in the buffer not read yet
+ * \param[in] reader A gho_reader_t
+ * \return the number of chars in the buffer not read yet
+ * @relates gho_reader_t
+ */
+size_t gho_reader_size(const gho_reader_t* const reader) {
+  return reader->end - reader->begin;
+}
+
+/**
+ * \brief Return true if there is nothing more to read, false otherwise
+ * \param[in] reader A gho_reader_t
+ * \return true if there is nothing more to read, false otherwise
+ * @relates gho_reader_t
+ */
+bool gho_reader_eof(gho_reader_t* reader) {
+  return reader->begin == reader->end && gho_reader_fill(reader) == false;
+}
+
+// Buffer
+
+/**
+ * \brief Read the next block of the file at the end of the buffer
+ * \param[in] reader A gho_reader_t
+ * \return true if new chars are read, false at the end of the file
+ * \warning The chars not read yet can be moved in the buffer: the pointers
+ *          returned by gho_reader_data, gho_reader_token and
+ *          gho_reader_word are invalidated
+ * @relates gho_reader_t
+ */
+bool gho_reader_fill(gho_reader_t* reader) {
+  if (reader->eof) { return false; }
+  // Move the chars not read yet at the beginning
+  if (reader->begin != 0) {
+    memmove(reader->data, reader->data + reader->begin,
+            reader->end - reader->begin);
+    reader->end -= reader->begin;
+    reader->begin = 0;
+  }
+  // Room for one block
+  if (reader->capacity - reader->end < gho_reader_block_size) {
+    reader->capacity =
+      gho_growth(reader->capacity, reader->end + gho_reader_block_size);
+    gho_array_realloc(reader->data, char, reader->capacity + 1);
+  }
+  const size_t n = fread(reader->data + reader->end, 1,
+                         reader->capacity - reader->end, reader->file);
+  reader->end += n;
+  reader->data[reader->end] = '\0';
+  if (n == 0) { reader->eof = true; }
+  return n != 0;
+}
+
+/**
+ * \brief Return the chars in the buffer not read yet
+ * \param[in] reader A gho_reader_t
+ * \return the gho_reader_size(reader) chars not read yet ('\0' terminated)
+ * @relates gho_reader_t
+ */
+const char* gho_reader_data(const gho_reader_t* const reader) {
+  return reader->data + reader->begin;
+}
+
+/**
+ * \brief Mark n chars of the buffer as read
+ * \param[in] reader A gho_reader_t
+ * \param[in] n      Number of chars (at most gho_reader_size(reader))
+ * @relates gho_reader_t
+ */
+void gho_reader_advance(gho_reader_t* reader, const size_t n) {
+  reader->begin += n;
+}
+
+// Read
+
+/**
+ * \brief Peek a char
+ * \param[in] reader A gho_reader_t
+ * \return the next char (as an unsigned char), EOF at the end of the file
+ * @relates gho_reader_t
+ */
+int gho_reader_peek(gho_reader_t* reader) {
+  if (gho_reader_eof(reader)) { return EOF; }
+  return (unsigned char)reader->data[reader->begin];
+}
+
+/**
+ * \brief Read a char
+ * \param[in] reader A gho_reader_t
+ * \return the char read (as an unsigned char), EOF at the end of the file
+ * @relates gho_reader_t
+ */
+int gho_reader_get(gho_reader_t* reader) {
+  const int c = gho_reader_peek(reader);
+  if (c != EOF) { ++reader->begin; }
+  return c;
+}
+
+/**
+ * \brief Read whitespace
+ * \param[in] reader A gho_reader_t
+ * @relates gho_reader_t
+ */
+void gho_reader_read_whitespace(gho_reader_t* reader) {
+  while (true) {
+    while (reader->begin != reader->end &&
+           isspace((unsigned char)reader->data[reader->begin]) != 0) {
+      ++reader->begin;
+    }
+    if (reader->begin != reader->end || gho_reader_fill(reader) == false) {
+      break;
+    }
+  }
+}
+
+/**
+ * \brief Find a char and keep in the buffer all chars before it
+ * \param[in] reader    A gho_reader_t
+ * \param[in] delimiter The char to be found
+ * \return the index of the char from gho_reader_data(reader),
+ *         gho_reader_size(reader) if the end of the file is reached before
+ * @relates gho_reader_t
+ */
+size_t gho_reader_find_char(gho_reader_t* reader, const char delimiter) {
+  size_t searched = 0;
+  while (true) {
+    const char* const data = gho_reader_data(reader);
+    const char* const p = (const char*)memchr(data + searched, delimiter,
+                                              gho_reader_size(reader) - searched);
+    if (p != NULL) { return (size_t)(p - data); }
+    searched = gho_reader_size(reader);
+    if (gho_reader_fill(reader) == false) { return searched; }
+  }
+}
+
+/**
+ * \brief Return true if a char ends a token, false otherwise
+ * \param[in] c A char
+ * \return true if c is a whitespace or a separator of the gho text format
+ *         (',', '{' or '}'), false otherwise
+ * \warning Do not use this function, use gho_reader_token
+ * @relates gho_reader_t
+ */
+bool gho_reader_is_token_end_(const char c) {
+  return isspace((unsigned char)c) != 0 || c == ',' || c == '{' || c == '}';
+}
+
+/**
+ * \brief Read whitespace and keep in the buffer the next token
+ * \param[in] reader A gho_reader_t
+ * \return the chars not read yet, the token is followed by a whitespace, a
+ *         separator (',', '{' or '}') or by the '\0' (end of the file)
+ * \note Only the chars of the token are scanned and the buffer is filled only
+ *       when the token reaches its end: reading "{1,2,3,...}" element by
+ *       element is linear
+ * \note Use gho_reader_set_data to mark the chars parsed as read, for example
+ *       after a gho_T_sread on the token
+ * @relates gho_reader_t
+ */
+const char* gho_reader_token(gho_reader_t* reader) {
+  gho_reader_read_whitespace(reader);
+  size_t i = 0;
+  while (true) {
+    const char* const data = gho_reader_data(reader);
+    const size_t size = gho_reader_size(reader);
+    while (i != size && gho_reader_is_token_end_(data[i]) == false) { ++i; }
+    if (i != size || gho_reader_fill(reader) == false) { break; }
+  }
+  return gho_reader_data(reader);
+}
+
+/**
+ * \brief Read whitespace and keep in the buffer the next word
+ * \param[in] reader A gho_reader_t
+ * \return the chars not read yet, the word is followed by a whitespace or by
+ *         the '\0' (end of the file)
+ * \note Unlike gho_reader_token, the separators are part of the word
+ * \note Use gho_reader_set_data to mark the chars parsed as read, for example
+ *       after a gho_c_str_sread on the word
+ * @relates gho_reader_t
+ */
+const char* gho_reader_word(gho_reader_t* reader) {
+  gho_reader_read_whitespace(reader);
+  size_t i = 0;
+  while (true) {
+    const char* const data = gho_reader_data(reader);
+    const size_t size = gho_reader_size(reader);
+    while (i != size && isspace((unsigned char)data[i]) == 0) { ++i; }
+    if (i != size || gho_reader_fill(reader) == false) { break; }
+  }
+  return gho_reader_data(reader);
+}
+
+/**
+ * \brief Mark as read all chars before a position in the buffer
+ * \param[in] reader A gho_reader_t
+ * \param[in] data   A position between gho_reader_data(reader) and
+ *                   gho_reader_data(reader) + gho_reader_size(reader)
+ * @relates gho_reader_t
+ */
+void gho_reader_set_data(gho_reader_t* reader, const char* const data) {
+  reader->begin = (size_t)(data - reader->data);
+}
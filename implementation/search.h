@@ -0,0 +1,297 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string.h>
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+
+/**
+ * \brief Find bytes in bytes
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] needle        The bytes to be found
+ * \param[in] needle_size   Number of bytes of the needle
+ * \return the index of the first occurrence of the needle, haystack_size if
+ *         not found or if the needle is empty
+ * @ingroup gho_search
+ */
+size_t gho_search_find(const char* const haystack, const size_t haystack_size,
+                       const char* const needle, const size_t needle_size) {
+  if (needle_size == 0 || needle_size > haystack_size) {
+    return haystack_size;
+  }
+  if (needle_size == 1) {
+    return gho_search_find_char(haystack, haystack_size, needle[0]);
+  }
+  if (needle_size < gho_search_two_way_size) {
+    return gho_search_find_filter_(haystack, haystack_size,
+                                   needle, needle_size);
+  }
+  return gho_search_find_two_way_(haystack, haystack_size,
+                                  needle, needle_size);
+}
+
+/**
+ * \brief Find bytes in bytes, from the end
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] needle        The bytes to be found
+ * \param[in] needle_size   Number of bytes of the needle
+ * \return the index of the last occurrence of the needle, haystack_size if
+ *         not found or if the needle is empty
+ * @ingroup gho_search
+ */
+size_t gho_search_rfind(const char* const haystack, const size_t haystack_size,
+                        const char* const needle, const size_t needle_size) {
+  if (needle_size == 0 || needle_size > haystack_size) {
+    return haystack_size;
+  }
+  if (needle_size == 1) {
+    return gho_search_rfind_char(haystack, haystack_size, needle[0]);
+  }
+  const char first = needle[0];
+  const char last = needle[needle_size - 1];
+  for (size_t i = haystack_size - needle_size + 1; i-- > 0; ) {
+    if (haystack[i] == first && haystack[i + needle_size - 1] == last &&
+        memcmp(haystack + i + 1, needle + 1, needle_size - 2) == 0) {
+      return i;
+    }
+  }
+  return haystack_size;
+}
+
+/**
+ * \brief Find a char in bytes
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] c             The char to be found
+ * \return the index of the first c, haystack_size if not found
+ * @ingroup gho_search
+ */
+size_t gho_search_find_char(const char* const haystack,
+                            const size_t haystack_size, const char c) {
+  const char* const p = (const char*)memchr(haystack, c, haystack_size);
+  return (p == NULL) ? haystack_size : (size_t)(p - haystack);
+}
+
+/**
+ * \brief Find a char in bytes, from the end
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] c             The char to be found
+ * \return the index of the last c, haystack_size if not found
+ * @ingroup gho_search
+ */
+size_t gho_search_rfind_char(const char* const haystack,
+                             const size_t haystack_size, const char c) {
+  for (size_t i = haystack_size; i-- > 0; ) {
+    if (haystack[i] == c) { return i; }
+  }
+  return haystack_size;
+}
+
+/**
+ * \brief Count the occurrences of bytes in bytes
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] needle        The bytes to be counted
+ * \param[in] needle_size   Number of bytes of the needle
+ * \return the number of occurrences of the needle (the occurrences which
+ *         overlap are counted), 0 if the needle is empty
+ * @ingroup gho_search
+ */
+size_t gho_search_count(const char* const haystack, const size_t haystack_size,
+                        const char* const needle, const size_t needle_size) {
+  size_t r = 0;
+  size_t i = 0;
+  for (;;) {
+    const size_t j = gho_search_find(haystack + i, haystack_size - i,
+                                     needle, needle_size);
+    if (j == haystack_size - i) { return r; }
+    ++r;
+    i += j + 1;
+  }
+}
+
+/**
+ * \brief Find bytes in bytes, the candidates are filtered on the first and on
+ *        the last byte of the needle
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] needle        The bytes to be found
+ * \param[in] needle_size   Number of bytes of the needle
+ *                          (2 <= needle_size <= haystack_size)
+ * \return the index of the first occurrence of the needle, haystack_size if
+ *         not found
+ * @ingroup gho_search
+ * \warning Do not use this function, use gho_search_find
+ */
+size_t gho_search_find_filter_(const char* const haystack,
+                               const size_t haystack_size,
+                               const char* const needle,
+                               const size_t needle_size) {
+  size_t i = 0;
+  #if defined(__AVX2__)
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needle_size - 1]);
+    for (; i + needle_size - 1 + 32 <= haystack_size; i += 32) {
+      const __m256i block_first =
+        _mm256_loadu_si256((const __m256i*)(haystack + i));
+      const __m256i block_last =
+        _mm256_loadu_si256((const __m256i*)(haystack + i + needle_size - 1));
+      unsigned int mask = (unsigned int)_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                         _mm256_cmpeq_epi8(last, block_last)));
+      while (mask != 0) {
+        const size_t j = i + (size_t)__builtin_ctz(mask);
+        if (memcmp(haystack + j + 1, needle + 1, needle_size - 2) == 0) {
+          return j;
+        }
+        mask &= mask - 1;
+      }
+    }
+  #elif defined(__SSE2__)
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_size - 1]);
+    for (; i + needle_size - 1 + 16 <= haystack_size; i += 16) {
+      const __m128i block_first =
+        _mm_loadu_si128((const __m128i*)(haystack + i));
+      const __m128i block_last =
+        _mm_loadu_si128((const __m128i*)(haystack + i + needle_size - 1));
+      unsigned int mask = (unsigned int)_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+                      _mm_cmpeq_epi8(last, block_last)));
+      while (mask != 0) {
+        const size_t j = i + (size_t)__builtin_ctz(mask);
+        if (memcmp(haystack + j + 1, needle + 1, needle_size - 2) == 0) {
+          return j;
+        }
+        mask &= mask - 1;
+      }
+    }
+  #endif
+  const char last_char = needle[needle_size - 1];
+  while (i + needle_size <= haystack_size) {
+    const char* const p =
+      (const char*)memchr(haystack + i, needle[0],
+                          haystack_size - needle_size + 1 - i);
+    if (p == NULL) { break; }
+    const size_t j = (size_t)(p - haystack);
+    if (haystack[j + needle_size - 1] == last_char &&
+        memcmp(haystack + j + 1, needle + 1, needle_size - 2) == 0) {
+      return j;
+    }
+    i = j + 1;
+  }
+  return haystack_size;
+}
+
+/**
+ * \brief Find bytes in bytes with the Two-Way algorithm (Crochemore and
+ *        Perrin), with a shift table on the last byte of the window
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] needle        The bytes to be found
+ * \param[in] needle_size   Number of bytes of the needle
+ *                          (2 <= needle_size <= haystack_size)
+ * \return the index of the first occurrence of the needle, haystack_size if
+ *         not found
+ * @ingroup gho_search
+ * \warning Do not use this function, use gho_search_find
+ */
+size_t gho_search_find_two_way_(const char* const haystack,
+                                const size_t haystack_size,
+                                const char* const needle,
+                                const size_t needle_size) {
+  const unsigned char* const h = (const unsigned char*)haystack;
+  const unsigned char* const n = (const unsigned char*)needle;
+  const size_t l = needle_size;
+  
+  // Shift table: 1 + last index of each byte in the needle, 0 if absent
+  size_t shift[256] = { 0 };
+  for (size_t i = 0; i < l; ++i) { shift[n[i]] = i + 1; }
+  
+  // Critical factorization: maximal suffix for the two orders
+  // (ip starts at -1, the arithmetic is modulo 2^n)
+  size_t ip = (size_t)-1;
+  size_t jp = 0;
+  size_t k = 1;
+  size_t p = 1;
+  while (jp + k < l) {
+    if (n[ip + k] == n[jp + k]) {
+      if (k == p) { jp += p; k = 1; }
+      else { ++k; }
+    }
+    else if (n[ip + k] > n[jp + k]) { jp += k; k = 1; p = jp - ip; }
+    else { ip = jp++; k = p = 1; }
+  }
+  size_t ms = ip;
+  const size_t p0 = p;
+  ip = (size_t)-1;
+  jp = 0;
+  k = p = 1;
+  while (jp + k < l) {
+    if (n[ip + k] == n[jp + k]) {
+      if (k == p) { jp += p; k = 1; }
+      else { ++k; }
+    }
+    else if (n[ip + k] < n[jp + k]) { jp += k; k = 1; p = jp - ip; }
+    else { ip = jp++; k = p = 1; }
+  }
+  if (ip + 1 > ms + 1) { ms = ip; }
+  else { p = p0; }
+  
+  // Periodic needle: the prefix already matched is memorized
+  size_t mem0;
+  if (memcmp(n, n + p, ms + 1) != 0) {
+    mem0 = 0;
+    p = ((ms > l - ms - 1) ? ms : l - ms - 1) + 1;
+  }
+  else {
+    mem0 = l - p;
+  }
+  size_t mem = 0;
+  
+  // Search
+  size_t i = 0;
+  while (haystack_size - i >= l) {
+    const unsigned char* const w = h + i;
+    // Last byte of the window (shift of l if the byte is not in the needle)
+    k = l - shift[w[l - 1]];
+    if (k != 0) {
+      if (k < mem) { k = mem; }
+      i += k;
+      mem = 0;
+      continue;
+    }
+    // Right part
+    for (k = ((ms + 1 > mem) ? ms + 1 : mem); k < l && n[k] == w[k]; ++k) { }
+    if (k < l) {
+      i += k - ms;
+      mem = 0;
+      continue;
+    }
+    // Left part
+    for (k = ms + 1; k > mem && n[k - 1] == w[k - 1]; --k) { }
+    if (k <= mem) { return i; }
+    i += p;
+    mem = mem0;
+  }
+  return haystack_size;
+}
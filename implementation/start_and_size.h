@@ -126,6 +126,18 @@ void gho_start_and_size_sprint(char** c_str,
   gho_start_and_size_sprinti(c_str, start_and_size, 0);
 }
 
+/**
+ * \brief Write a gho_start_and_size_t in a file with the binary format
+ * \param[in] file           A C file
+ * \param[in] start_and_size A gho_start_and_size_t
+ * @relates gho_start_and_size_t
+ */
+void gho_start_and_size_fwrite_bin(FILE* file,
+                            const gho_start_and_size_t* const start_and_size) {
+  gho_binary_fwrite_size(file, start_and_size->start);
+  gho_binary_fwrite_size(file, start_and_size->size);
+}
+
 // Input
 
 /**
@@ -160,6 +172,48 @@ gho_start_and_size_t gho_start_and_size_sread(const char** c_str) {
   return r;
 }
 
+/**
+ * \brief Read a gho_start_and_size_t from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the gho_start_and_size_t read
+ * @relates gho_start_and_size_t
+ */
+gho_start_and_size_t gho_start_and_size_rread(gho_reader_t* reader) {
+  gho_start_and_size_t r;
+  gho_reader_read_whitespace(reader); gho_char_rread(reader); // "{ "
+  r.start = gho_size_t_rread(reader);
+  gho_reader_read_whitespace(reader); gho_char_rread(reader); // ", "
+  r.size = gho_size_t_rread(reader);
+  gho_reader_read_whitespace(reader); gho_char_rread(reader); // "}"
+  return r;
+}
+
+/**
+ * \brief Read a gho_start_and_size_t from a file with the binary format
+ * \param[in] file A C file
+ * \return the gho_start_and_size_t read
+ * @relates gho_start_and_size_t
+ */
+gho_start_and_size_t gho_start_and_size_fread_bin(FILE* file) {
+  gho_start_and_size_t r;
+  r.start = gho_binary_fread_size(file);
+  r.size = gho_binary_fread_size(file);
+  return r;
+}
+
+/**
+ * \brief Read a gho_start_and_size_t from a file with the binary format
+ * \param[in] file           A C file
+ * \param[in] start_and_size A pointer on an not initialized
+ *                           gho_start_and_size_t
+ * \warning Do not use this function, use gho_start_and_size_fread_bin
+ * @relates gho_start_and_size_t
+ */
+void gho_start_and_size_fread_bin_(FILE* file,
+                                   gho_start_and_size_t* start_and_size) {
+  *start_and_size = gho_start_and_size_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -201,6 +255,17 @@ bool gho_start_and_size_equal(const gho_start_and_size_t* const a,
   return a->start == b->start && a->size == b->size;
 }
 
+/**
+ * \brief Hash a gho_start_and_size_t
+ * \param[in] start_and_size A gho_start_and_size_t
+ * \return the hash of the gho_start_and_size_t
+ * @relates gho_start_and_size_t
+ */
+size_t gho_start_and_size_hash(const gho_start_and_size_t* const start_and_size) {
+  return gho_hash_combine(gho_size_t_hash(&start_and_size->start),
+                          gho_size_t_hash(&start_and_size->size));
+}
+
 // Conversion
 
 /**
@@ -212,7 +277,9 @@ bool gho_start_and_size_equal(const gho_start_and_size_t* const a,
 gho_string_t gho_start_and_size_to_string(
                              const gho_start_and_size_t* const start_and_size) {
   gho_string_t r = gho_string_create();
-  gho_start_and_size_sprint(&r.c_str, start_and_size);
+  char* c_str = gho_c_str_create();
+  gho_start_and_size_sprint(&c_str, start_and_size);
+  gho_string_absorb_c_str(&r, &c_str);
   return r;
 }
 
@@ -224,17 +291,18 @@ gho_string_t gho_start_and_size_to_string(
  */
 gho_any_t gho_start_and_size_to_any(
                              const gho_start_and_size_t* const start_and_size) {
-  gho_any_t r = gho_any_create();
-  r.type = GHO_TYPE_GHO_START_AND_SIZE;
-  r.size_of_struct = sizeof(gho_start_and_size_t);
-  gho_start_and_size_t* p = gho_alloc(gho_start_and_size_t);
-  gho_start_and_size_copy_(start_and_size, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_start_and_size_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_start_and_size_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_start_and_size_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_start_and_size_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_start_and_size_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_start_and_size_to_string;
+  static const gho_any_vtable_t vtable = {
+    GHO_TYPE_GHO_START_AND_SIZE, sizeof(gho_start_and_size_t),
+    (gho_destroy_fct_t)gho_start_and_size_destroy,
+    (gho_fprinti_fct_t)gho_start_and_size_fprinti,
+    (gho_sprinti_fct_t)gho_start_and_size_sprinti,
+    (gho_copy_fct_t)gho_start_and_size_copy_,
+    (gho_equal_fct_t)gho_start_and_size_equal,
+    (gho_to_string_fct_t)gho_start_and_size_to_string,
+    (gho_fwrite_bin_fct_t)gho_start_and_size_fwrite_bin
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_start_and_size_copy_(start_and_size,
+                           (gho_start_and_size_t*)gho_any_data(&r));
   return r;
 }
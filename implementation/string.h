@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../memory.h"
 #include "../c_str.h"
 #include "../math_T.h"
 
@@ -30,6 +31,8 @@
 gho_string_t gho_string_create() {
   gho_string_t string;
   string.c_str = gho_c_str_create();
+  string.size = 0;
+  string.capacity = 0;
   return string;
 }
 
@@ -55,24 +58,46 @@ gho_string_t gho_string_create_from_c_str(const char* const c_str) {
  */
 void gho_string_absorb(gho_string_t* string, gho_string_t* string_moved) {
   gho_string_destroy(string);
-  string->c_str = string_moved->c_str;
+  *string = *string_moved;
   string_moved->c_str = NULL;
+  string_moved->size = 0;
+  string_moved->capacity = 0;
 }
 
 /**
  * \brief Move a C string in a gho_string_t
  * \param[in] string      A gho_string_t
- * \param[in] c_str_moved A C string
+ * \param[in] c_str_moved A C string of gho (memory of gho_malloc)
  * \warning The string_moved variable is moved, do not use it
  *          after this function
+ * \warning A C string of malloc (strdup, getline, ...) must be moved with
+ *          gho_string_absorb_malloc_c_str
  * @relates gho_string_t
  */
 void gho_string_absorb_c_str(gho_string_t* string, char** c_str_moved) {
   gho_string_destroy(string);
   string->c_str = *c_str_moved;
+  string->size = gho_c_str_size(string->c_str);
+  string->capacity = string->size;
   *c_str_moved = NULL;
 }
 
+/**
+ * \brief Move a C string of malloc in a gho_string_t
+ * \param[in] string      A gho_string_t
+ * \param[in] c_str_moved A C string of malloc (strdup, getline, ...)
+ * \warning The c_str_moved variable is moved, do not use it
+ *          after this function
+ * @relates gho_string_t
+ */
+void gho_string_absorb_malloc_c_str(gho_string_t* string,
+                                    char** c_str_moved) {
+  const size_t size = gho_c_str_size(*c_str_moved);
+  char* c_str = (char*)gho_absorb_malloc(*c_str_moved, size + 1);
+  *c_str_moved = NULL;
+  gho_string_absorb_c_str(string, &c_str);
+}
+
 /**
  * \brief Destroy a gho_string_t
  * \param[in] string A gho_string_t
@@ -80,15 +105,24 @@ void gho_string_absorb_c_str(gho_string_t* string, char** c_str_moved) {
  */
 void gho_string_destroy(gho_string_t* string) {
   gho_c_str_destroy(&string->c_str);
+  string->size = 0;
+  string->capacity = 0;
 }
 
 /**
  * \brief Reset a gho_string_t
- * \param[in] string A gho_string_t
+ * \param[in] string A gho_string_t (can be moved by gho_string_absorb)
+ * \note The capacity is kept
  * @relates gho_string_t
  */
 void gho_string_reset(gho_string_t* string) {
-  gho_c_str_reset(&string->c_str);
+  // A moved gho_string_t has no C string
+  if (string->c_str == NULL) {
+    *string = gho_string_create();
+    return;
+  }
+  string->c_str[0] = '\0';
+  string->size = 0;
 }
 
 // Output
@@ -146,6 +180,17 @@ void gho_string_sprint(char** c_str, const gho_string_t* const string) {
   gho_c_str_sprint(c_str, string->c_str);
 }
 
+/**
+ * \brief Write a gho_string_t in a file with the binary format
+ * \param[in] file   A C file
+ * \param[in] string A gho_string_t
+ * @relates gho_string_t
+ */
+void gho_string_fwrite_bin(FILE* file, const gho_string_t* const string) {
+  gho_binary_fwrite_size(file, string->size);
+  gho_binary_fwrite_block(file, string->c_str, 1, string->size);
+}
+
 // Input
 
 /**
@@ -174,6 +219,46 @@ gho_string_t gho_string_sread(const char** c_str) {
   return r;
 }
 
+/**
+ * \brief Read a gho_string_t from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the gho_string_t read
+ * @relates gho_string_t
+ */
+gho_string_t gho_string_rread(gho_reader_t* reader) {
+  gho_string_t r = gho_string_create();
+  char* c_str_read = gho_c_str_rread(reader);
+  gho_string_absorb_c_str(&r, &c_str_read);
+  return r;
+}
+
+/**
+ * \brief Read a gho_string_t from a file with the binary format
+ * \param[in] file A C file
+ * \return the gho_string_t read
+ * @relates gho_string_t
+ */
+gho_string_t gho_string_fread_bin(FILE* file) {
+  gho_string_t r = gho_string_create();
+  const size_t size = gho_binary_fread_size(file);
+  gho_string_reserve(&r, size);
+  gho_binary_fread_block(file, r.c_str, 1, size);
+  r.size = size;
+  r.c_str[r.size] = '\0';
+  return r;
+}
+
+/**
+ * \brief Read a gho_string_t from a file with the binary format
+ * \param[in] file   A C file
+ * \param[in] string A pointer on an not initialized gho_string_t
+ * \warning Do not use this function, use gho_string_fread_bin
+ * @relates gho_string_t
+ */
+void gho_string_fread_bin_(FILE* file, gho_string_t* string) {
+  *string = gho_string_fread_bin(file);
+}
+
 // Copy & comparisons
 
 /**
@@ -196,7 +281,8 @@ gho_string_t gho_string_copy(const gho_string_t* const string) {
  * @relates gho_string_t
  */
 void gho_string_copy_(const gho_string_t* const string, gho_string_t* copy) {
-  *copy = gho_string_create();;
+  *copy = gho_string_create();
+  gho_string_reserve(copy, string->size);
   gho_string_add(copy, string);
 }
 
@@ -209,7 +295,7 @@ void gho_string_copy_(const gho_string_t* const string, gho_string_t* copy) {
  */
 bool gho_string_equal(const gho_string_t* const a,
                       const gho_string_t* const b) {
-  return gho_c_str_equal(a->c_str, b->c_str);
+  return a->size == b->size && memcmp(a->c_str, b->c_str, a->size) == 0;
 }
 
 /**
@@ -235,12 +321,23 @@ int gho_string_compare(const gho_string_t* const a,
   return gho_c_str_compare(a->c_str, b->c_str);
 }
 
+/**
+ * \brief Hash a gho_string_t (same hash as the C string)
+ * \param[in] string A gho_string_t
+ * \return the hash of the gho_string_t
+ * @relates gho_string_t
+ */
+size_t gho_string_hash(const gho_string_t* const string) {
+  return gho_hash_bytes(string->c_str, string->size);
+}
+
 // Conversion
 
 /**
  * \brief Convert a gho_string_t into a C string
  * \param[in] string A gho_string_t
  * \return the C string from the gho_string_t
+ *         (free it with gho_c_str_destroy, not with free)
  * @relates gho_string_t
  */
 char* gho_string_to_c_str(const gho_string_t* const string) {
@@ -266,7 +363,7 @@ gho_string_t gho_string_to_string(const gho_string_t* const string) {
  * @relates gho_string_t
  */
 size_t gho_string_size(const gho_string_t* const string) {
-  return gho_c_str_size(string->c_str);
+  return string->size;
 }
 
 /**
@@ -276,7 +373,42 @@ size_t gho_string_size(const gho_string_t* const string) {
  * @relates gho_string_t
  */
 bool gho_string_empty(const gho_string_t* const string) {
-  return gho_c_str_empty(string->c_str);
+  return string->size == 0;
+}
+
+/**
+ * \brief Return the capacity of a gho_string_t
+ * \param[in] string A gho_string_t
+ * \return the number of chars that can be stored without reallocation
+ * @relates gho_string_t
+ */
+size_t gho_string_capacity(const gho_string_t* const string) {
+  return string->capacity;
+}
+
+/**
+ * \brief Reserve memory for at least capacity chars
+ * \param[in] string   A gho_string_t
+ * \param[in] capacity Number of chars (without the '\0')
+ * @relates gho_string_t
+ */
+void gho_string_reserve(gho_string_t* string, const size_t capacity) {
+  if (capacity > string->capacity) {
+    gho_array_realloc(string->c_str, char, capacity + 1);
+    string->capacity = capacity;
+  }
+}
+
+/**
+ * \brief Reserve memory for at least n chars with a geometric growth
+ * \param[in] string A gho_string_t
+ * \param[in] n      Number of chars (without the '\0')
+ * @relates gho_string_t
+ */
+void gho_string_grow(gho_string_t* string, const size_t n) {
+  if (string->capacity < n) {
+    gho_string_reserve(string, gho_growth(string->capacity, n));
+  }
 }
 
 // Get & Set
@@ -313,7 +445,7 @@ void gho_string_set(gho_string_t* string, const size_t i, const char c) {
  */
 void gho_string_add(gho_string_t* string,
                     const gho_string_t* const to_be_added) {
-  gho_c_str_add(&string->c_str, to_be_added->c_str);
+  gho_string_add_c_str_n(string, to_be_added->c_str, to_be_added->size);
 }
 
 /**
@@ -323,7 +455,22 @@ void gho_string_add(gho_string_t* string,
  * @relates gho_string_t
  */
 void gho_string_add_c_str(gho_string_t* string, const char* const to_be_added) {
-  gho_c_str_add(&string->c_str, to_be_added);
+  gho_string_add_c_str_n(string, to_be_added, gho_c_str_size(to_be_added));
+}
+
+/**
+ * \brief Add the n first chars of a C string at the end
+ * \param[in] string      A gho_string_t
+ * \param[in] to_be_added The C string to be added (at least n chars)
+ * \param[in] n           Number of chars to be added
+ * @relates gho_string_t
+ */
+void gho_string_add_c_str_n(gho_string_t* string,
+                            const char* const to_be_added, const size_t n) {
+  gho_string_grow(string, string->size + n);
+  memcpy(string->c_str + string->size, to_be_added, n);
+  string->size += n;
+  string->c_str[string->size] = '\0';
 }
 
 /**
@@ -333,7 +480,25 @@ void gho_string_add_c_str(gho_string_t* string, const char* const to_be_added) {
  * @relates gho_string_t
  */
 void gho_string_add_char(gho_string_t* string, const char to_be_added) {
-  gho_c_str_add_char(&string->c_str, to_be_added);
+  gho_string_grow(string, string->size + 1);
+  string->c_str[string->size] = to_be_added;
+  ++string->size;
+  string->c_str[string->size] = '\0';
+}
+
+/**
+ * \brief Add n times a char at the end
+ * \param[in] string      A gho_string_t
+ * \param[in] to_be_added The char to be added
+ * \param[in] n           Number of chars to be added
+ * @relates gho_string_t
+ */
+void gho_string_add_char_n(gho_string_t* string, const char to_be_added,
+                           const size_t n) {
+  gho_string_grow(string, string->size + n);
+  memset(string->c_str + string->size, to_be_added, n);
+  string->size += n;
+  string->c_str[string->size] = '\0';
 }
 
 /**
@@ -345,7 +510,13 @@ void gho_string_add_char(gho_string_t* string, const char to_be_added) {
  */
 void gho_string_add_char_i(gho_string_t* string, const char to_be_added,
                            const size_t i) {
-  gho_c_str_add_char_i(&string->c_str, to_be_added, i);
+  if (i >= string->size) {
+    fprintf(stderr, "ERROR: gho_string_add_char_i: out of range!\n");
+    exit(1);
+  }
+  gho_string_add_char(string, ' ');
+  memmove(string->c_str + i + 1, string->c_str + i, string->size - 1 - i);
+  string->c_str[i] = to_be_added;
 }
 
 // Remove
@@ -357,7 +528,17 @@ void gho_string_add_char_i(gho_string_t* string, const char to_be_added,
  * @relates gho_string_t
  */
 void gho_string_remove(gho_string_t* string, const size_t i) {
-  gho_c_str_remove(&string->c_str, i);
+  if (string->size == 0) {
+    fprintf(stderr, "ERROR: gho_string_remove: string is empty!\n");
+    exit(1);
+  }
+  else if (i >= string->size) {
+    fprintf(stderr, "ERROR: gho_string_remove: out of range!\n");
+    exit(1);
+  }
+  else {
+    gho_string_remove_between(string, i, i + 1);
+  }
 }
 
 /**
@@ -366,7 +547,14 @@ void gho_string_remove(gho_string_t* string, const size_t i) {
  * @relates gho_string_t
  */
 void gho_string_remove_last(gho_string_t* string) {
-  gho_c_str_remove_last(&string->c_str);
+  if (string->size == 0) {
+    fprintf(stderr, "ERROR: gho_string_remove_last: string is empty!\n");
+    exit(1);
+  }
+  else {
+    --string->size;
+    string->c_str[string->size] = '\0';
+  }
 }
 
 /**
@@ -381,9 +569,10 @@ void gho_string_remove_between(gho_string_t* string,
   const size_t size = gho_string_size(string);
   const size_t first_real = gho_T_min(gho_T_min(first, last), size);
   const size_t last_real = gho_T_min(gho_T_max(first, last), size);
-  for (size_t i = 0; i < last_real - first_real; ++i) {
-    gho_string_remove(string, first_real);
-  }
+  // Move the end of the string (with the '\0')
+  memmove(string->c_str + first_real, string->c_str + last_real,
+          size - last_real + 1);
+  string->size -= last_real - first_real;
 }
 
 /**
@@ -418,7 +607,8 @@ void gho_string_remove_after(gho_string_t* string, const size_t i) {
  */
 size_t gho_string_find(const gho_string_t* const string,
                        const gho_string_t* const value) {
-  return gho_string_find_c_str(string, value->c_str);
+  return gho_search_find(string->c_str, string->size,
+                         value->c_str, value->size);
 }
 
 /**
@@ -430,7 +620,8 @@ size_t gho_string_find(const gho_string_t* const string,
  */
 size_t gho_string_find_c_str(const gho_string_t* const string,
                              const char* const value) {
-  return gho_c_str_find(string->c_str, value);
+  return gho_search_find(string->c_str, string->size,
+                         value, gho_c_str_size(value));
 }
 
 /**
@@ -442,7 +633,78 @@ size_t gho_string_find_c_str(const gho_string_t* const string,
  */
 size_t gho_string_find_char(const gho_string_t* const string,
                             const char value) {
-  return gho_c_str_find_char(string->c_str, value);
+  return gho_search_find_char(string->c_str, string->size, value);
+}
+
+/**
+ * \brief Find a value in a gho_string_t, from an index
+ * \param[in] string A gho_string_t
+ * \param[in] value  The string to be found
+ * \param[in] i      Index where the search begins
+ * \return the index of the first value found at an index >= i, the size of
+ *         the string if not found
+ * @relates gho_string_t
+ */
+size_t gho_string_find_from(const gho_string_t* const string,
+                            const gho_string_t* const value, const size_t i) {
+  if (i >= string->size) { return string->size; }
+  return i + gho_search_find(string->c_str + i, string->size - i,
+                             value->c_str, value->size);
+}
+
+/**
+ * \brief Find a value in a gho_string_t, from the end
+ * \param[in] string A gho_string_t
+ * \param[in] value  The string to be found
+ * \return the index of the last value found, the size of the string if not
+ *         found
+ * @relates gho_string_t
+ */
+size_t gho_string_rfind(const gho_string_t* const string,
+                        const gho_string_t* const value) {
+  return gho_search_rfind(string->c_str, string->size,
+                          value->c_str, value->size);
+}
+
+/**
+ * \brief Find a value in a gho_string_t, from the end
+ * \param[in] string A gho_string_t
+ * \param[in] value  The C string to be found
+ * \return the index of the last value found, the size of the string if not
+ *         found
+ * @relates gho_string_t
+ */
+size_t gho_string_rfind_c_str(const gho_string_t* const string,
+                              const char* const value) {
+  return gho_search_rfind(string->c_str, string->size,
+                          value, gho_c_str_size(value));
+}
+
+/**
+ * \brief Find a value in a gho_string_t, from the end
+ * \param[in] string A gho_string_t
+ * \param[in] value  The char to be found
+ * \return the index of the last value found, the size of the string if not
+ *         found
+ * @relates gho_string_t
+ */
+size_t gho_string_rfind_char(const gho_string_t* const string,
+                             const char value) {
+  return gho_search_rfind_char(string->c_str, string->size, value);
+}
+
+/**
+ * \brief Count the occurrences of a value in a gho_string_t
+ * \param[in] string A gho_string_t
+ * \param[in] value  The string to be counted
+ * \return the number of occurrences (the occurrences which overlap are
+ *         counted)
+ * @relates gho_string_t
+ */
+size_t gho_string_count(const gho_string_t* const string,
+                        const gho_string_t* const value) {
+  return gho_search_count(string->c_str, string->size,
+                          value->c_str, value->size);
 }
 
 /**
@@ -454,7 +716,7 @@ size_t gho_string_find_char(const gho_string_t* const string,
  */
 bool gho_string_contains(const gho_string_t* const string,
                          const gho_string_t* const value) {
-  return gho_string_contains_c_str(string, value->c_str);
+  return gho_string_find(string, value) != string->size;
 }
 
 /**
@@ -466,7 +728,7 @@ bool gho_string_contains(const gho_string_t* const string,
  */
 bool gho_string_contains_c_str(const gho_string_t* const string,
                                const char* const value) {
-  return gho_c_str_contains(string->c_str, value);
+  return gho_string_find_c_str(string, value) != string->size;
 }
 
 // Get line
@@ -612,6 +874,77 @@ gho_string_t gho_string_peek_line_from_c_str_delimiter(const char** c_str,
   return r;
 }
 
+/**
+ * \brief Read a line from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the first line in the gho_reader_t
+ * @relates gho_string_t
+ */
+gho_string_t gho_string_get_line_from_reader(gho_reader_t* reader) {
+  return gho_string_get_line_from_reader_delimiter(reader, '\n');
+}
+
+/**
+ * \brief Ignore a line from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * @relates gho_string_t
+ */
+void gho_string_ignore_line_from_reader(gho_reader_t* reader) {
+  gho_c_str_ignore_line_from_reader(reader);
+}
+
+/**
+ * \brief Peek a line from a gho_reader_t
+ * \param[in] reader A gho_reader_t
+ * \return the first line in the gho_reader_t
+ * @relates gho_string_t
+ */
+gho_string_t gho_string_peek_line_from_reader(gho_reader_t* reader) {
+  return gho_string_peek_line_from_reader_delimiter(reader, '\n');
+}
+
+/**
+ * \brief Read a line from a gho_reader_t until a delimiter
+ * \param[in] reader    A gho_reader_t
+ * \param[in] delimiter The delimiter
+ * \return the first line in the gho_reader_t until the delimiter is found
+ * @relates gho_string_t
+ */
+gho_string_t gho_string_get_line_from_reader_delimiter(gho_reader_t* reader,
+                                                       const char delimiter) {
+  gho_string_t r = gho_string_create();
+  char* c_str_line = gho_c_str_get_line_from_reader_delimiter(reader, delimiter);
+  gho_string_absorb_c_str(&r, &c_str_line);
+  return r;
+}
+
+/**
+ * \brief Ignore a line from a gho_reader_t until a delimiter
+ * \param[in] reader    A gho_reader_t
+ * \param[in] delimiter The delimiter
+ * @relates gho_string_t
+ */
+void gho_string_ignore_line_from_reader_delimiter(gho_reader_t* reader,
+                                                  const char delimiter) {
+  gho_c_str_ignore_line_from_reader_delimiter(reader, delimiter);
+}
+
+/**
+ * \brief Peek a line from a gho_reader_t until a delimiter
+ * \param[in] reader    A gho_reader_t
+ * \param[in] delimiter The delimiter
+ * \return the first line in the gho_reader_t until the delimiter is found
+ * @relates gho_string_t
+ */
+gho_string_t gho_string_peek_line_from_reader_delimiter(gho_reader_t* reader,
+                                                        const char delimiter) {
+  gho_string_t r = gho_string_create();
+  char* c_str_line =
+    gho_c_str_peek_line_from_reader_delimiter(reader, delimiter);
+  gho_string_absorb_c_str(&r, &c_str_line);
+  return r;
+}
+
 // C++
 
 #if defined(__cplusplus)
@@ -0,0 +1,75 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "../../search.h"
+
+
+// Find
+
+/**
+ * \brief Find all the occurrences of a value in bytes
+ * \param[in] haystack      Bytes
+ * \param[in] haystack_size Number of bytes of the haystack
+ * \param[in] needle        The bytes to be found
+ * \param[in] needle_size   Number of bytes of the needle
+ * \return the indexes of the occurrences (the occurrences which overlap are
+ *         found)
+ * @relates gho_vector_size_t_t
+ * \warning Do not use this function, use gho_c_str_find_all or
+ *          gho_string_find_all
+ */
+gho_vector_size_t_t gho_vector_size_t_find_all_(const char* const haystack,
+                                                const size_t haystack_size,
+                                                const char* const needle,
+                                                const size_t needle_size) {
+  gho_vector_size_t_t r = gho_vector_size_t_create();
+  size_t i = 0;
+  for (;;) {
+    const size_t j = gho_search_find(haystack + i, haystack_size - i,
+                                     needle, needle_size);
+    if (j == haystack_size - i) { return r; }
+    const size_t index = i + j;
+    gho_vector_size_t_add(&r, &index);
+    i = index + 1;
+  }
+}
+
+/**
+ * \brief Find all the occurrences of a value in a C string
+ * \param[in] c_str A C string
+ * \param[in] value The C string to be found
+ * \return the indexes of the occurrences (the occurrences which overlap are
+ *         found), empty if value is empty
+ * @relates gho_c_str_t
+ */
+gho_vector_size_t_t gho_c_str_find_all(const char* const c_str,
+                                       const char* const value) {
+  return gho_vector_size_t_find_all_(c_str, gho_c_str_size(c_str),
+                                     value, gho_c_str_size(value));
+}
+
+/**
+ * \brief Find all the occurrences of a value in a gho_string_t
+ * \param[in] string A gho_string_t
+ * \param[in] value  The string to be found
+ * \return the indexes of the occurrences (the occurrences which overlap are
+ *         found), empty if value is empty
+ * @relates gho_string_t
+ */
+gho_vector_size_t_t gho_string_find_all(const gho_string_t* const string,
+                                        const gho_string_t* const value) {
+  return gho_vector_size_t_find_all_(string->c_str, string->size,
+                                     value->c_str, value->size);
+}
@@ -14,12 +14,18 @@
 
 
 #include <stdlib.h>
+#include <string.h>
+#ifdef gho_with_pthread
+  #include <pthread.h>
+#endif
 
 #include "../memory.h"
 #include "../c_str.h"
 #include "../char.h"
 #include "../output.h"
 #include "../math.h"
+#include "../unused.h"
+#include "../hash.h"
 
 
 // Create & destroy
@@ -90,7 +96,7 @@ void gho_vector_T_destroy(gho_vector_T_t* vector) {
   
   vector->size = 0u;
   vector->capacity = 0u;
-  free(vector->array); vector->array = NULL;
+  gho_free(vector->array); vector->array = NULL;
 }
 
 /**
@@ -152,14 +158,23 @@ void gho_vector_T_print(const gho_vector_T_t* const vector) {
  */
 void gho_vector_T_sprinti(char** c_str, const gho_vector_T_t* const vector,
                           const unsigned int indent) {
-  gho_sprinti(c_str, indent);
-  gho_c_str_add(c_str, "{ ");
+  // The vector is built in a gho_string_t (amortized append) and each element
+  // in a small C string, then the result is added in c_str in one go
+  gho_string_t r = gho_string_create();
+  char* element = gho_c_str_create();
+  gho_string_add_char_n(&r, ' ', indent);
+  gho_string_add_c_str_n(&r, "{ ", 2);
   for (size_t i = 0; i < vector->size; ++i) {
-    gho_T_sprint(c_str, &vector->array[i]);
-    if (i != vector->size - 1) { gho_c_str_add(c_str, ","); }
-    gho_c_str_add(c_str, " ");
+    element[0] = '\0';
+    gho_T_sprint(&element, &vector->array[i]);
+    gho_string_add_c_str(&r, element);
+    if (i != vector->size - 1) { gho_string_add_char(&r, ','); }
+    gho_string_add_char(&r, ' ');
   }
-  gho_c_str_add(c_str, "}");
+  gho_string_add_char(&r, '}');
+  gho_c_str_add_n(c_str, r.c_str, r.size);
+  gho_c_str_destroy(&element);
+  gho_string_destroy(&r);
 }
 
 /**
@@ -172,6 +187,28 @@ void gho_vector_T_sprint(char** c_str, const gho_vector_T_t* const vector) {
   gho_vector_T_sprinti(c_str, vector, 0);
 }
 
+#ifdef gho_T_fwrite_bin
+/**
+ * \brief Write a gho_vector_T in a file with the binary format
+ * \param[in] file   A C file
+ * \param[in] vector A gho_vector_T
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_fwrite_bin(FILE* file, const gho_vector_T_t* const vector) {
+  #ifdef gho_T_bin_block
+    gho_binary_fwrite_header(file, vector->type, sizeof(T_t));
+    gho_binary_fwrite_size(file, vector->size);
+    gho_binary_fwrite_block(file, vector->array, sizeof(T_t), vector->size);
+  #else
+    gho_binary_fwrite_header(file, vector->type, 0);
+    gho_binary_fwrite_size(file, vector->size);
+    for (size_t i = 0; i < vector->size; ++i) {
+      gho_T_fwrite_bin(file, &vector->array[i]);
+    }
+  #endif
+}
+#endif
+
 // Input
 
 #ifdef gho_T_fread
@@ -234,6 +271,74 @@ gho_vector_T_t gho_vector_T_sread(const char** c_str) {
 }
 #endif
 
+#ifdef gho_T_rread
+/**
+ * @brief Read a gho_vector_T from a gho_reader_t
+ * @param[in] reader A gho_reader_t
+ * @return the gho_vector_T read
+ * @relates gho_vector_T_t
+ */
+gho_vector_T_t gho_vector_T_rread(gho_reader_t* reader) {
+  gho_vector_T_t r = gho_vector_T_create();
+  gho_reader_read_whitespace(reader);
+  gho_char_rread(reader); // '{'
+  gho_reader_read_whitespace(reader);
+  while (gho_reader_peek(reader) != '}' && gho_reader_peek(reader) != EOF) {
+    // T
+    T_t tmp = gho_T_rread(reader);
+    gho_vector_T_add_absorb(&r, &tmp);
+    // ,
+    gho_reader_read_whitespace(reader);
+    if (gho_reader_peek(reader) == ',') {
+      gho_char_rread(reader); // ','
+      gho_reader_read_whitespace(reader);
+    }
+  }
+  gho_char_rread(reader); // '}'
+  return r;
+}
+#endif
+
+#ifdef gho_T_fread_bin
+/**
+ * @brief Read a gho_vector_T from a file with the binary format
+ * @param[in] file A C file
+ * @return the gho_vector_T read
+ * @relates gho_vector_T_t
+ */
+gho_vector_T_t gho_vector_T_fread_bin(FILE* file) {
+  gho_vector_T_t r;
+  gho_vector_T_fread_bin_(file, &r);
+  return r;
+}
+
+/**
+ * @brief Read a gho_vector_T from a file with the binary format
+ * @param[in] file   A C file
+ * @param[in] vector A pointer on an not initialized gho_vector_T
+ * \warning Do not use this function, use gho_vector_T_fread_bin
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_fread_bin_(FILE* file, gho_vector_T_t* vector) {
+  *vector = gho_vector_T_create();
+  #ifdef gho_T_bin_block
+    gho_binary_fread_header(file, vector->type, sizeof(T_t));
+    const size_t size = gho_binary_fread_size(file);
+    gho_vector_T_reserve(vector, size);
+    gho_binary_fread_block(file, vector->array, sizeof(T_t), size);
+    vector->size = size;
+  #else
+    gho_binary_fread_header(file, vector->type, 0);
+    const size_t size = gho_binary_fread_size(file);
+    gho_vector_T_reserve(vector, size);
+    for (size_t i = 0; i < size; ++i) {
+      vector->array[i] = gho_T_fread_bin(file);
+      ++vector->size;
+    }
+  #endif
+}
+#endif
+
 // Copy & comparisons
 
 /**
@@ -333,27 +438,33 @@ int gho_vector_T_compare(const gho_vector_T_t* const a,
  */
 gho_string_t gho_vector_T_to_string(const gho_vector_T_t* const vector) {
   gho_string_t r = gho_string_create();
-  gho_vector_T_sprint(&r.c_str, vector);
+  char* c_str = gho_c_str_create();
+  gho_vector_T_sprint(&c_str, vector);
+  gho_string_absorb_c_str(&r, &c_str);
   return r;
 }
 
 /**
  * \brief Convert a gho_vector_T into a gho_any
  * \param[in] vector A gho_vector_T
- * \return the gho_any from the gho_vector_T
+ * \return the gho_any from the gho_vector_T (without binary format, use
+ *         gho_vector_T_fwrite_bin on the gho_vector_T)
  * @relates gho_vector_T_t
  */
 gho_any_t gho_vector_T_to_any(const gho_vector_T_t* const vector) {
-  gho_any_t r = gho_any_create();
-  r.size_of_struct = sizeof(gho_vector_T_t);
-  gho_vector_T_t* p = gho_alloc(gho_vector_T_t); gho_vector_T_copy_(vector, p);
-  r.any = p; p = NULL;
-  r.destroy_fct = (gho_destroy_fct_t)gho_vector_T_destroy;
-  r.fprinti_fct = (gho_fprinti_fct_t)gho_vector_T_fprinti;
-  r.sprinti_fct = (gho_sprinti_fct_t)gho_vector_T_sprinti;
-  r.copy_fct = (gho_copy_fct_t)gho_vector_T_copy_;
-  r.equal_fct = (gho_equal_fct_t)gho_vector_T_equal;
-  r.to_string_fct = (gho_to_string_fct_t)gho_vector_T_to_string;
+  static const gho_any_vtable_t vtable = {
+    gho_type_vector_T, sizeof(gho_vector_T_t),
+    (gho_destroy_fct_t)gho_vector_T_destroy,
+    (gho_fprinti_fct_t)gho_vector_T_fprinti,
+    (gho_sprinti_fct_t)gho_vector_T_sprinti,
+    (gho_copy_fct_t)gho_vector_T_copy_,
+    (gho_equal_fct_t)gho_vector_T_equal,
+    (gho_to_string_fct_t)gho_vector_T_to_string,
+    // gho_any_fread_bin can not read a vector: gho_any_fwrite_bin refuses it
+    NULL
+  };
+  gho_any_t r = gho_any_create_(&vtable);
+  gho_vector_T_copy_(vector, (gho_vector_T_t*)gho_any_data(&r));
   return r;
 }
 
@@ -424,6 +535,19 @@ void gho_vector_T_resize(gho_vector_T_t* vector, const size_t n) {
   }
 }
 
+/**
+ * \brief Update the capacity of a gho_vector_T with the growth policy
+ *        (gho_T_growth) to store at least n elements
+ * \param[in] vector A gho_vector_T
+ * \param[in] n      Number of elements needed
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_grow(gho_vector_T_t* vector, const size_t n) {
+  if (vector->capacity < n) {
+    gho_vector_T_reserve(vector, gho_T_growth(vector->capacity, n));
+  }
+}
+
 // Get & Set
 
 /**
@@ -459,13 +583,9 @@ void gho_vector_T_set(gho_vector_T_t* vector, const size_t i,
  * @relates gho_vector_T_t
  */
 void gho_vector_T_add(gho_vector_T_t* vector, const T_t* const to_be_added) {
-  if (vector->size + 1 <= vector->capacity) {
-    vector->array[vector->size] = gho_T_copy(to_be_added);
-    ++vector->size;
-  } else {
-    gho_vector_T_reserve(vector, vector->capacity + 10);
-    gho_vector_T_add(vector, to_be_added);
-  }
+  gho_vector_T_grow(vector, vector->size + 1);
+  vector->array[vector->size] = gho_T_copy(to_be_added);
+  ++vector->size;
 }
 
 /**
@@ -498,13 +618,9 @@ void gho_vector_T_add_ptr(gho_vector_T_t* vector,
  * @relates gho_vector_T_t
  */
 void gho_vector_T_add_absorb(gho_vector_T_t* vector, T_t* to_be_added) {
-  if (vector->size + 1 <= vector->capacity) {
-    vector->array[vector->size] = *to_be_added;
-    ++vector->size;
-  } else {
-    gho_vector_T_reserve(vector, vector->capacity + 10);
-    gho_vector_T_add_absorb(vector, to_be_added);
-  }
+  gho_vector_T_grow(vector, vector->size + 1);
+  vector->array[vector->size] = *to_be_added;
+  ++vector->size;
 }
 
 /**
@@ -515,14 +631,11 @@ void gho_vector_T_add_absorb(gho_vector_T_t* vector, T_t* to_be_added) {
  */
 void gho_vector_T_add_vector(gho_vector_T_t* vector,
                              const gho_vector_T_t* const to_be_added) {
-  if (vector->size + to_be_added->size <= vector->capacity) {
-    for (size_t i = 0; i < to_be_added->size; ++i) {
-      vector->array[vector->size] = gho_T_copy(&to_be_added->array[i]);
-      ++vector->size;
-    }
-  } else {
-    gho_vector_T_reserve(vector, vector->size + to_be_added->size);
-    gho_vector_T_add_vector(vector, to_be_added);
+  const size_t n = to_be_added->size;
+  gho_vector_T_grow(vector, vector->size + n);
+  for (size_t i = 0; i < n; ++i) {
+    vector->array[vector->size] = gho_T_copy(&to_be_added->array[i]);
+    ++vector->size;
   }
 }
 
@@ -539,18 +652,10 @@ void gho_vector_T_insert(gho_vector_T_t* vector,
     fprintf(stderr, "ERROR: gho_vector_T_insert: invalid index!\n");
     exit(1);
   }
-  if (vector->size + 1 <= vector->capacity) {
-    for (size_t j = vector->size + 1; j > i + 1; --j) {
-      if (j != vector->size + 1) { gho_T_destroy(&vector->array[j - 1]); }
-      vector->array[j - 1] = gho_T_copy(&vector->array[j - 2]);
-    }
-    if (i != vector->size) { gho_T_destroy(&vector->array[i]); }
-    vector->array[i] = gho_T_copy(to_be_added);
-    ++vector->size;
-  } else {
-    gho_vector_T_reserve(vector, vector->capacity + 10);
-    gho_vector_T_insert(vector, to_be_added, i);
-  }
+  gho_vector_T_grow(vector, vector->size + 1);
+  gho_T_move(vector->array + i + 1, vector->array + i, vector->size - i);
+  vector->array[i] = gho_T_copy(to_be_added);
+  ++vector->size;
 }
 
 /**
@@ -592,18 +697,10 @@ void gho_vector_T_insert_absorb(gho_vector_T_t* vector,
     fprintf(stderr, "ERROR: gho_vector_T_insert: invalid index!\n");
     exit(1);
   }
-  if (vector->size + 1 <= vector->capacity) {
-    for (size_t j = vector->size + 1; j > i + 1; --j) {
-      if (j != vector->size + 1) { gho_T_destroy(&vector->array[j - 1]); }
-      vector->array[j - 1] = gho_T_copy(&vector->array[j - 2]);
-    }
-    if (i != vector->size) { gho_T_destroy(&vector->array[i]); }
-    vector->array[i] = *to_be_added;
-    ++vector->size;
-  } else {
-    gho_vector_T_reserve(vector, vector->capacity + 10);
-    gho_vector_T_insert(vector, to_be_added, i);
-  }
+  gho_vector_T_grow(vector, vector->size + 1);
+  gho_T_move(vector->array + i + 1, vector->array + i, vector->size - i);
+  vector->array[i] = *to_be_added;
+  ++vector->size;
 }
 
 /**
@@ -622,9 +719,9 @@ void gho_vector_T_remove(gho_vector_T_t* vector, const size_t i) {
     exit(1);
   }
   else {
-    for (size_t j = i; j < gho_vector_T_size(vector) - 1; ++j) {
-      vector->array[j] = gho_T_copy(&vector->array[j + 1]);
-    }
+    gho_T_destroy(&vector->array[i]);
+    gho_T_move(vector->array + i, vector->array + i + 1,
+               vector->size - i - 1);
     --vector->size;
   }
 }
@@ -671,14 +768,910 @@ size_t gho_vector_T_find_T(gho_vector_T_t* vector, const T_t v) {
 
 #ifdef gho_T_compare
 /**
- * \brief Sort a gho_vector_T
+ * \brief Sort a gho_vector_T (introsort: quicksort, heapsort if the recursion
+ *        is too deep, insertion sort for the small parts)
  * \param[in] vector A gho_vector_T
  * @relates gho_vector_T_t
  */
 void gho_vector_T_sort(gho_vector_T_t* vector) {
-  typedef int (*compare_fct_t)(const void*, const void*);
-  qsort(vector->array, vector->size,
-        sizeof(vector->array[0]),
-        (compare_fct_t)gho_T_compare);
+  size_t depth = 0;
+  for (size_t n = vector->size; n > 1; n /= 2) { depth += 2; }
+  gho_vector_T_introsort_(vector->array, vector->size, depth);
+}
+
+/**
+ * \brief Sort a gho_vector_T, the equal elements keep their order
+ *        (merge sort)
+ * \param[in] vector A gho_vector_T
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_stable_sort(gho_vector_T_t* vector) {
+  if (vector->size <= 1) { return; }
+  T_t* buffer = gho_array_alloc(T_t, vector->size);
+  gho_vector_T_merge_sort_(vector->array, vector->size, buffer);
+  gho_free(buffer);
+}
+
+/**
+ * \brief Sort a gho_vector_T with threads (each thread sorts a part, then the
+ *        parts are merged in parallel)
+ * \param[in] vector    A gho_vector_T
+ * \param[in] nb_thread Number of threads
+ * \warning Without gho_with_pthread, the vector is sorted by gho_vector_T_sort
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_parallel_sort(gho_vector_T_t* vector,
+                                const size_t nb_thread) {
+  #ifdef gho_with_pthread
+  const size_t n = vector->size;
+  // Parts of at least 4096 elements
+  size_t nb_part = nb_thread;
+  if (nb_part > n / 4096) { nb_part = n / 4096; }
+  if (nb_part <= 1) { gho_vector_T_sort(vector); return; }
+  gho_vector_T_sort_task_t_* task =
+    gho_array_alloc(gho_vector_T_sort_task_t_, nb_part);
+  pthread_t* thread = gho_array_alloc(pthread_t, nb_part);
+  bool* thread_created = gho_array_alloc(bool, nb_part);
+  size_t* bound = gho_array_alloc(size_t, nb_part + 1);
+  for (size_t i = 0; i <= nb_part; ++i) { bound[i] = n / nb_part * i; }
+  bound[nb_part] = n;
+  // Sort the parts
+  for (size_t i = 0; i < nb_part; ++i) {
+    task[i].source = vector->array;
+    task[i].destination = NULL;
+    task[i].begin = bound[i];
+    task[i].middle = bound[i + 1];
+    task[i].end = bound[i + 1];
+    thread_created[i] = (i + 1 != nb_part) &&
+      (pthread_create(&thread[i], NULL, gho_vector_T_sort_thread_,
+                      &task[i]) == 0);
+    if (thread_created[i] == false) { gho_vector_T_sort_thread_(&task[i]); }
+  }
+  for (size_t i = 0; i < nb_part; ++i) {
+    if (thread_created[i]) { pthread_join(thread[i], NULL); }
+  }
+  // Merge the parts (width parts with width parts)
+  T_t* source = vector->array;
+  T_t* destination = gho_array_alloc(T_t, n);
+  T_t* const buffer = destination;
+  for (size_t width = 1; width < nb_part; width *= 2) {
+    size_t nb_task = 0;
+    for (size_t i = 0; i < nb_part; i += 2 * width) {
+      task[nb_task].source = source;
+      task[nb_task].destination = destination;
+      task[nb_task].begin = bound[i];
+      task[nb_task].middle = bound[gho_T_min(i + width, nb_part)];
+      task[nb_task].end = bound[gho_T_min(i + 2 * width, nb_part)];
+      ++nb_task;
+    }
+    for (size_t i = 0; i < nb_task; ++i) {
+      thread_created[i] = (i + 1 != nb_task) &&
+        (pthread_create(&thread[i], NULL, gho_vector_T_merge_thread_,
+                        &task[i]) == 0);
+      if (thread_created[i] == false) { gho_vector_T_merge_thread_(&task[i]); }
+    }
+    for (size_t i = 0; i < nb_task; ++i) {
+      if (thread_created[i]) { pthread_join(thread[i], NULL); }
+    }
+    T_t* tmp = source; source = destination; destination = tmp;
+  }
+  if (source != vector->array) {
+    memcpy(vector->array, source, sizeof(T_t) * n);
+  }
+  gho_free(buffer);
+  gho_free(bound);
+  gho_free(thread_created);
+  gho_free(thread);
+  gho_free(task);
+  #else
+  gho_unused(nb_thread);
+  gho_vector_T_sort(vector);
+  #endif
+}
+
+/**
+ * \brief Sort an array with insertion sort (stable)
+ * \param[in] array An array of T
+ * \param[in] n     Size of the array
+ * \warning Do not use this function, it is used by the sort functions
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_insertion_sort_(T_t* array, const size_t n) {
+  for (size_t i = 1; i < n; ++i) {
+    const T_t t = array[i];
+    size_t j = i;
+    while (j > 0 && gho_T_compare(&array[j - 1], &t) > 0) {
+      array[j] = array[j - 1];
+      --j;
+    }
+    array[j] = t;
+  }
+}
+
+/**
+ * \brief Sort an array with heapsort
+ * \param[in] array An array of T
+ * \param[in] n     Size of the array
+ * \warning Do not use this function, it is used by gho_vector_T_sort
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_heap_sort_(T_t* array, const size_t n) {
+  for (size_t i = n / 2; i > 0; --i) {
+    gho_vector_T_sift_down_(array, i - 1, n);
+  }
+  for (size_t i = n; i > 1; --i) {
+    const T_t tmp = array[0]; array[0] = array[i - 1]; array[i - 1] = tmp;
+    gho_vector_T_sift_down_(array, 0, i - 1);
+  }
+}
+
+/**
+ * \brief Move down the element i in the max-heap of n elements
+ * \param[in] array An array of T
+ * \param[in] i     Index of the element
+ * \param[in] n     Size of the heap
+ * \warning Do not use this function, it is used by gho_vector_T_heap_sort_
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_sift_down_(T_t* array, size_t i, const size_t n) {
+  const T_t t = array[i];
+  while (2 * i + 1 < n) {
+    size_t child = 2 * i + 1;
+    if (child + 1 < n && gho_T_compare(&array[child], &array[child + 1]) < 0) {
+      ++child;
+    }
+    if (gho_T_compare(&t, &array[child]) >= 0) { break; }
+    array[i] = array[child];
+    i = child;
+  }
+  array[i] = t;
+}
+
+/**
+ * \brief Sort an array with introsort
+ * \param[in] array An array of T
+ * \param[in] n     Size of the array
+ * \param[in] depth Number of partitions before using heapsort
+ * \warning Do not use this function, it is used by gho_vector_T_sort
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_introsort_(T_t* array, size_t n, size_t depth) {
+  while (n > 16) {
+    if (depth == 0) { gho_vector_T_heap_sort_(array, n); return; }
+    --depth;
+    // Median of three in array[0] (the pivot)
+    T_t tmp;
+    const size_t m = n / 2;
+    if (gho_T_compare(&array[m], &array[0]) < 0) {
+      tmp = array[m]; array[m] = array[0]; array[0] = tmp;
+    }
+    if (gho_T_compare(&array[n - 1], &array[m]) < 0) {
+      tmp = array[n - 1]; array[n - 1] = array[m]; array[m] = tmp;
+      if (gho_T_compare(&array[m], &array[0]) < 0) {
+        tmp = array[m]; array[m] = array[0]; array[0] = tmp;
+      }
+    }
+    tmp = array[m]; array[m] = array[0]; array[0] = tmp;
+    // Partition (array[n - 1] >= pivot and array[0] == pivot stop the loops)
+    size_t i = 0;
+    size_t j = n;
+    while (true) {
+      do { ++i; } while (gho_T_compare(&array[i], &array[0]) < 0);
+      do { --j; } while (gho_T_compare(&array[0], &array[j]) < 0);
+      if (i >= j) { break; }
+      tmp = array[i]; array[i] = array[j]; array[j] = tmp;
+    }
+    tmp = array[j]; array[j] = array[0]; array[0] = tmp;
+    // Recursion on the smallest part, loop on the biggest one
+    if (j < n - j - 1) {
+      gho_vector_T_introsort_(array, j, depth);
+      array += j + 1;
+      n -= j + 1;
+    }
+    else {
+      gho_vector_T_introsort_(array + j + 1, n - j - 1, depth);
+      n = j;
+    }
+  }
+  gho_vector_T_insertion_sort_(array, n);
+}
+
+/**
+ * \brief Merge two sorted arrays (stable)
+ * \param[in]  a      A sorted array of T
+ * \param[in]  a_size Size of a
+ * \param[in]  b      A sorted array of T
+ * \param[in]  b_size Size of b
+ * \param[out] r      Array of a_size + b_size T (the elements are moved)
+ * \warning Do not use this function, it is used by the sort functions
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_merge_(const T_t* a, const size_t a_size,
+                         const T_t* b, const size_t b_size, T_t* r) {
+  const T_t* const a_end = a + a_size;
+  const T_t* const b_end = b + b_size;
+  while (a != a_end && b != b_end) {
+    if (gho_T_compare(b, a) < 0) { *r = *b; ++b; }
+    else { *r = *a; ++a; }
+    ++r;
+  }
+  while (a != a_end) { *r = *a; ++a; ++r; }
+  while (b != b_end) { *r = *b; ++b; ++r; }
+}
+
+/**
+ * \brief Sort an array with a bottom-up merge sort (stable)
+ * \param[in] array  An array of T
+ * \param[in] n      Size of the array
+ * \param[in] buffer An array of n T
+ * \warning Do not use this function, it is used by gho_vector_T_stable_sort
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_merge_sort_(T_t* array, const size_t n, T_t* buffer) {
+  const size_t run = 32;
+  for (size_t i = 0; i < n; i += run) {
+    gho_vector_T_insertion_sort_(array + i, gho_T_min(run, n - i));
+  }
+  T_t* source = array;
+  T_t* destination = buffer;
+  for (size_t width = run; width < n; width *= 2) {
+    for (size_t i = 0; i < n; i += 2 * width) {
+      const size_t middle = gho_T_min(i + width, n);
+      const size_t end = gho_T_min(i + 2 * width, n);
+      gho_vector_T_merge_(source + i, middle - i, source + middle,
+                          end - middle, destination + i);
+    }
+    T_t* tmp = source; source = destination; destination = tmp;
+  }
+  if (source != array) { memcpy(array, source, sizeof(T_t) * n); }
+}
+
+#ifdef gho_with_pthread
+/**
+ * \brief Sort a part of an array (function of a thread)
+ * \param[in] task A gho_vector_T_sort_task_t_
+ * \return NULL
+ * \warning Do not use this function, it is used by gho_vector_T_parallel_sort
+ * @relates gho_vector_T_t
+ */
+void* gho_vector_T_sort_thread_(void* task) {
+  gho_vector_T_sort_task_t_* t = (gho_vector_T_sort_task_t_*)task;
+  const size_t n = t->end - t->begin;
+  size_t depth = 0;
+  for (size_t i = n; i > 1; i /= 2) { depth += 2; }
+  gho_vector_T_introsort_(t->source + t->begin, n, depth);
+  return NULL;
+}
+
+/**
+ * \brief Merge two sorted parts of an array (function of a thread)
+ * \param[in] task A gho_vector_T_sort_task_t_
+ * \return NULL
+ * \warning Do not use this function, it is used by gho_vector_T_parallel_sort
+ * @relates gho_vector_T_t
+ */
+void* gho_vector_T_merge_thread_(void* task) {
+  gho_vector_T_sort_task_t_* t = (gho_vector_T_sort_task_t_*)task;
+  gho_vector_T_merge_(t->source + t->begin, t->middle - t->begin,
+                      t->source + t->middle, t->end - t->middle,
+                      t->destination + t->begin);
+  return NULL;
+}
+#endif
+#endif
+
+#ifdef gho_T_radix_key
+/**
+ * \brief Sort a gho_vector_T with a LSD radix sort (one pass by byte of T,
+ *        the passes where all the elements have the same byte are skipped)
+ * \param[in] vector A gho_vector_T
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_radix_sort(gho_vector_T_t* vector) {
+  const size_t n = vector->size;
+  if (n <= 1) { return; }
+  T_t* source = vector->array;
+  T_t* destination = gho_array_alloc(T_t, n);
+  T_t* const buffer = destination;
+  for (size_t byte = 0; byte < sizeof(T_t); ++byte) {
+    const unsigned int shift = 8 * (unsigned int)byte;
+    size_t count[256] = { 0 };
+    for (size_t i = 0; i < n; ++i) {
+      ++count[(gho_T_radix_key(source[i]) >> shift) & 0xFF];
+    }
+    if (count[(gho_T_radix_key(source[0]) >> shift) & 0xFF] == n) {
+      continue;
+    }
+    size_t position = 0;
+    for (size_t k = 0; k < 256; ++k) {
+      const size_t c = count[k];
+      count[k] = position;
+      position += c;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      destination[count[(gho_T_radix_key(source[i]) >> shift) & 0xFF]++] =
+        source[i];
+    }
+    T_t* tmp = source; source = destination; destination = tmp;
+  }
+  if (source != vector->array) {
+    memcpy(vector->array, source, sizeof(T_t) * n);
+  }
+  gho_free(buffer);
+}
+#endif
+
+#ifdef gho_T_compare
+/**
+ * \brief Return the first position where v can be inserted in a sorted
+ *        gho_vector_T (binary search, without branch for the integers)
+ * \param[in] vector A sorted gho_vector_T
+ * \param[in] v      A T
+ * \return the index of the first element >= v, the size if there is not
+ * @relates gho_vector_T_t
+ */
+size_t gho_vector_T_lower_bound(const gho_vector_T_t* const vector,
+                                const T_t* const v) {
+  if (vector->size == 0) { return 0; }
+  const T_t* base = vector->array;
+  size_t n = vector->size;
+  while (n > 1) {
+    const size_t half = n / 2;
+    #ifdef gho_T_integer
+      base = (base[half] < *v) ? base + half : base;
+    #else
+      if (gho_T_compare(&base[half], v) < 0) { base += half; }
+    #endif
+    n -= half;
+  }
+  #ifdef gho_T_integer
+    return (size_t)(base - vector->array) + (*base < *v);
+  #else
+    return (size_t)(base - vector->array) + (gho_T_compare(base, v) < 0);
+  #endif
+}
+
+/**
+ * \brief Return the last position where v can be inserted in a sorted
+ *        gho_vector_T (binary search, without branch for the integers)
+ * \param[in] vector A sorted gho_vector_T
+ * \param[in] v      A T
+ * \return the index of the first element > v, the size if there is not
+ * @relates gho_vector_T_t
+ */
+size_t gho_vector_T_upper_bound(const gho_vector_T_t* const vector,
+                                const T_t* const v) {
+  if (vector->size == 0) { return 0; }
+  const T_t* base = vector->array;
+  size_t n = vector->size;
+  while (n > 1) {
+    const size_t half = n / 2;
+    #ifdef gho_T_integer
+      base = (*v < base[half]) ? base : base + half;
+    #else
+      if (gho_T_compare(v, &base[half]) >= 0) { base += half; }
+    #endif
+    n -= half;
+  }
+  #ifdef gho_T_integer
+    return (size_t)(base - vector->array) + (*v >= *base);
+  #else
+    return (size_t)(base - vector->array) + (gho_T_compare(v, base) >= 0);
+  #endif
+}
+
+/**
+ * \brief Find a value in a sorted gho_vector_T (binary search)
+ * \param[in] vector A sorted gho_vector_T
+ * \param[in] v      The T to be found
+ * \return the index of the first element equal to v, the size of the vector
+ *         if not found
+ * @relates gho_vector_T_t
+ */
+size_t gho_vector_T_binary_find(const gho_vector_T_t* const vector,
+                                const T_t* const v) {
+  const size_t i = gho_vector_T_lower_bound(vector, v);
+  if (i != vector->size && gho_T_compare(&vector->array[i], v) == 0) {
+    return i;
+  }
+  return vector->size;
+}
+
+/**
+ * \brief Insert a T in a sorted gho_vector_T (after the equal elements)
+ * \param[in] vector A sorted gho_vector_T
+ * \param[in] v      The T to be inserted
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_insert_sorted(gho_vector_T_t* vector, const T_t* const v) {
+  gho_vector_T_insert(vector, v, gho_vector_T_upper_bound(vector, v));
+}
+
+/**
+ * \brief Merge two sorted gho_vector_T
+ * \param[in] a A sorted gho_vector_T
+ * \param[in] b A sorted gho_vector_T
+ * \return the sorted gho_vector_T with the elements of a and b
+ * @relates gho_vector_T_t
+ */
+gho_vector_T_t gho_vector_T_merge_sorted(const gho_vector_T_t* const a,
+                                         const gho_vector_T_t* const b) {
+  gho_vector_T_t r = gho_vector_T_create();
+  gho_vector_T_reserve(&r, a->size + b->size);
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a->size && j < b->size) {
+    if (gho_T_compare(&b->array[j], &a->array[i]) < 0) {
+      r.array[r.size++] = gho_T_copy(&b->array[j++]);
+    }
+    else {
+      r.array[r.size++] = gho_T_copy(&a->array[i++]);
+    }
+  }
+  while (i < a->size) { r.array[r.size++] = gho_T_copy(&a->array[i++]); }
+  while (j < b->size) { r.array[r.size++] = gho_T_copy(&b->array[j++]); }
+  return r;
+}
+
+/**
+ * \brief Union of two sorted gho_vector_T
+ * \param[in] a A sorted gho_vector_T
+ * \param[in] b A sorted gho_vector_T
+ * \return the sorted gho_vector_T with the elements in a or in b (an element
+ *         is max(number in a, number in b) times in the result)
+ * @relates gho_vector_T_t
+ */
+gho_vector_T_t gho_vector_T_set_union(const gho_vector_T_t* const a,
+                                      const gho_vector_T_t* const b) {
+  gho_vector_T_t r = gho_vector_T_create();
+  gho_vector_T_reserve(&r, a->size + b->size);
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a->size && j < b->size) {
+    const int c = gho_T_compare(&a->array[i], &b->array[j]);
+    if (c < 0) { r.array[r.size++] = gho_T_copy(&a->array[i++]); }
+    else if (c > 0) { r.array[r.size++] = gho_T_copy(&b->array[j++]); }
+    else { r.array[r.size++] = gho_T_copy(&a->array[i++]); ++j; }
+  }
+  while (i < a->size) { r.array[r.size++] = gho_T_copy(&a->array[i++]); }
+  while (j < b->size) { r.array[r.size++] = gho_T_copy(&b->array[j++]); }
+  return r;
+}
+
+/**
+ * \brief Intersection of two sorted gho_vector_T
+ * \param[in] a A sorted gho_vector_T
+ * \param[in] b A sorted gho_vector_T
+ * \return the sorted gho_vector_T with the elements in a and in b (an element
+ *         is min(number in a, number in b) times in the result)
+ * @relates gho_vector_T_t
+ */
+gho_vector_T_t gho_vector_T_set_intersection(const gho_vector_T_t* const a,
+                                             const gho_vector_T_t* const b) {
+  gho_vector_T_t r = gho_vector_T_create();
+  gho_vector_T_reserve(&r, gho_T_min(a->size, b->size));
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a->size && j < b->size) {
+    const int c = gho_T_compare(&a->array[i], &b->array[j]);
+    if (c < 0) { ++i; }
+    else if (c > 0) { ++j; }
+    else { r.array[r.size++] = gho_T_copy(&a->array[i++]); ++j; }
+  }
+  return r;
+}
+
+/**
+ * \brief Difference of two sorted gho_vector_T
+ * \param[in] a A sorted gho_vector_T
+ * \param[in] b A sorted gho_vector_T
+ * \return the sorted gho_vector_T with the elements in a and not in b (an
+ *         element is (number in a - number in b) times in the result)
+ * @relates gho_vector_T_t
+ */
+gho_vector_T_t gho_vector_T_set_difference(const gho_vector_T_t* const a,
+                                           const gho_vector_T_t* const b) {
+  gho_vector_T_t r = gho_vector_T_create();
+  gho_vector_T_reserve(&r, a->size);
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a->size && j < b->size) {
+    const int c = gho_T_compare(&a->array[i], &b->array[j]);
+    if (c < 0) { r.array[r.size++] = gho_T_copy(&a->array[i++]); }
+    else if (c > 0) { ++j; }
+    else { ++i; ++j; }
+  }
+  while (i < a->size) { r.array[r.size++] = gho_T_copy(&a->array[i++]); }
+  return r;
+}
+#endif
+
+#ifdef gho_T_hash
+/**
+ * \brief Remove the duplicates of a gho_vector_T (the first occurrences stay
+ *        in the same order), in O(n) with a hash table of indices
+ * \param[in] vector A gho_vector_T
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_unique(gho_vector_T_t* vector) {
+  const size_t n = vector->size;
+  if (n <= 1) { return; }
+  // Indices of the elements kept (n for an empty slot)
+  const size_t capacity = gho_hash_capacity(n);
+  const size_t mask = capacity - 1;
+  size_t* index = gho_array_alloc(size_t, capacity);
+  for (size_t i = 0; i < capacity; ++i) { index[i] = n; }
+  size_t size = 0;
+  for (size_t i = 0; i < n; ++i) {
+    size_t k = gho_T_hash(&vector->array[i]) & mask;
+    while (index[k] != n &&
+           gho_T_equal(&vector->array[index[k]], &vector->array[i]) == false) {
+      k = (k + 1) & mask;
+    }
+    if (index[k] != n) {
+      gho_T_destroy(&vector->array[i]);
+    }
+    else {
+      if (size != i) { gho_T_move(&vector->array[size], &vector->array[i], 1); }
+      index[k] = size;
+      ++size;
+    }
+  }
+  vector->size = size;
+  gho_free(index);
+}
+#endif
+
+// Arithmetic
+
+#ifdef gho_T_integer
+/**
+ * \brief Check that two gho_vector_T have the same size
+ * \param[in] function_name Name of the calling function
+ * \param[in] a             A gho_vector_T
+ * \param[in] b             A gho_vector_T
+ * \warning Do not use this function, it is used by gho_vector_T_op_*
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_check_size_(const char* const function_name,
+                                 const gho_vector_T_t* const a,
+                                 const gho_vector_T_t* const b) {
+  #ifndef NDEBUG
+  if (a->size != b->size) {
+    fprintf(stderr, "ERROR: %s: the vectors have different sizes "
+                    "(%zu != %zu)!\n", function_name, a->size, b->size);
+    exit(1);
+  }
+  #else
+  gho_unused(function_name); gho_unused(a); gho_unused(b);
+  #endif
+}
+
+/**
+ * \brief r[i] += v[i] for all i
+ * \param[in] r A gho_vector_T
+ * \param[in] v A gho_vector_T with the same size
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_add(gho_vector_T_t* r, const gho_vector_T_t* const v) {
+  gho_vector_T_op_check_size_("gho_vector_T_op_add", r, v);
+  T_t* p_r = r->array;
+  const T_t* const p_v = v->array;
+  const size_t n = r->size;
+  for (size_t i = 0; i < n; ++i) {
+    p_r[i] += p_v[i];
+  }
+}
+
+/**
+ * \brief r[i] -= v[i] for all i
+ * \param[in] r A gho_vector_T
+ * \param[in] v A gho_vector_T with the same size
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_sub(gho_vector_T_t* r, const gho_vector_T_t* const v) {
+  gho_vector_T_op_check_size_("gho_vector_T_op_sub", r, v);
+  T_t* p_r = r->array;
+  const T_t* const p_v = v->array;
+  const size_t n = r->size;
+  for (size_t i = 0; i < n; ++i) {
+    p_r[i] -= p_v[i];
+  }
+}
+
+/**
+ * \brief r[i] *= v[i] for all i
+ * \param[in] r A gho_vector_T
+ * \param[in] v A gho_vector_T with the same size
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_mul(gho_vector_T_t* r, const gho_vector_T_t* const v) {
+  gho_vector_T_op_check_size_("gho_vector_T_op_mul", r, v);
+  T_t* p_r = r->array;
+  const T_t* const p_v = v->array;
+  const size_t n = r->size;
+  for (size_t i = 0; i < n; ++i) {
+    p_r[i] *= p_v[i];
+  }
+}
+
+/**
+ * \brief r[i] += a * x[i] for all i
+ * \param[in] r A gho_vector_T
+ * \param[in] a A T
+ * \param[in] x A gho_vector_T with the same size
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_axpy(gho_vector_T_t* r, const T_t a,
+                          const gho_vector_T_t* const x) {
+  gho_vector_T_op_check_size_("gho_vector_T_op_axpy", r, x);
+  T_t* p_r = r->array;
+  const T_t* const p_x = x->array;
+  const size_t n = r->size;
+  for (size_t i = 0; i < n; ++i) {
+    p_r[i] += a * p_x[i];
+  }
+}
+
+/**
+ * \brief Return the dot product of two gho_vector_T
+ * \param[in] a A gho_vector_T
+ * \param[in] b A gho_vector_T with the same size
+ * \return the sum of the a[i] * b[i]
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_vector_T_t
+ */
+T_t gho_vector_T_op_dot(const gho_vector_T_t* const a,
+                        const gho_vector_T_t* const b) {
+  gho_vector_T_op_check_size_("gho_vector_T_op_dot", a, b);
+  const T_t* const p_a = a->array;
+  const T_t* const p_b = b->array;
+  const size_t n = a->size;
+  T_t r = 0;
+  for (size_t i = 0; i < n; ++i) {
+    r += p_a[i] * p_b[i];
+  }
+  return r;
+}
+
+/**
+ * \brief r[i] = r[i] ^ e for all i (exponentiation by squaring)
+ * \param[in] r A gho_vector_T
+ * \param[in] e The exponent
+ * \warning The overflows are not detected (loop without branch)
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_pow(gho_vector_T_t* r, const gho_ullint e) {
+  // The elements are processed by blocks: for each bit of e, the loops on the
+  // block are without branch
+  T_t* p_r = r->array;
+  const size_t n = r->size;
+  T_t base[64];
+  for (size_t begin = 0; begin < n; begin += 64) {
+    const size_t size = gho_T_min(n - begin, (size_t)64);
+    T_t* const block = p_r + begin;
+    for (size_t i = 0; i < size; ++i) {
+      base[i] = block[i];
+      block[i] = 1;
+    }
+    for (gho_ullint bits = e; bits != 0; bits >>= 1) {
+      if (bits & 1) {
+        for (size_t i = 0; i < size; ++i) { block[i] *= base[i]; }
+      }
+      if (bits > 1) {
+        for (size_t i = 0; i < size; ++i) { base[i] *= base[i]; }
+      }
+    }
+  }
+}
+#endif
+
+#ifdef gho_T_integer
+/**
+ * \brief r[i] = floor(r[i] / d) for all i
+ * \param[in] r       A gho_vector_T
+ * \param[in] divider A gho_divider_t of d (d > 0 for an unsigned T)
+ * \note The divisions are multiplications and shifts, see gho_divider_t
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_floor_div_q(gho_vector_T_t* r,
+                                 const gho_divider_t* const divider) {
+  T_t* p_r = r->array;
+  const size_t n = r->size;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t i = 0; i < n; ++i) {
+    const gho_ullint v_abs = gho_vector_T_abs_(p_r[i]);
+    const bool is_negative = gho_vector_T_is_negative_(p_r[i]);
+    p_r[i] = (T_t)gho_divider_floor_div_q_(&local_divider, v_abs, is_negative);
+  }
+}
+
+/**
+ * \brief r[i] = r[i] - d * floor(r[i] / d) for all i
+ * \param[in] r       A gho_vector_T
+ * \param[in] divider A gho_divider_t of d (d > 0 for an unsigned T)
+ * \note The divisions are multiplications and shifts, see gho_divider_t
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_floor_div_r(gho_vector_T_t* r,
+                                 const gho_divider_t* const divider) {
+  T_t* p_r = r->array;
+  const size_t n = r->size;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t i = 0; i < n; ++i) {
+    const gho_ullint v_abs = gho_vector_T_abs_(p_r[i]);
+    const bool is_negative = gho_vector_T_is_negative_(p_r[i]);
+    p_r[i] = (T_t)gho_divider_floor_div_r_(&local_divider, v_abs, is_negative);
+  }
+}
+
+/**
+ * \brief r[i] = r[i] / d for all i, d divides all the r[i]
+ * \param[in] r       A gho_vector_T
+ * \param[in] divider A gho_divider_t of d (d > 0 for an unsigned T)
+ * \note The divisions are multiplications by the inverse of d
+ * \warning The results are wrong for the r[i] not divisible by d
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_div_exact(gho_vector_T_t* r,
+                               const gho_divider_t* const divider) {
+  T_t* p_r = r->array;
+  const size_t n = r->size;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t i = 0; i < n; ++i) {
+    const gho_ullint v_abs = gho_vector_T_abs_(p_r[i]);
+    const bool is_negative = gho_vector_T_is_negative_(p_r[i]);
+    p_r[i] = (T_t)gho_divider_div_exact_(&local_divider, v_abs, is_negative);
+  }
+}
+
+/**
+ * \brief r[i] = r[i] modulo d for all i
+ * \param[in] r       A gho_vector_T
+ * \param[in] divider A gho_divider_t of d
+ * \note The results are in [0, |d|)
+ * \note The divisions are multiplications and shifts, see gho_divider_t
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_mod(gho_vector_T_t* r,
+                         const gho_divider_t* const divider) {
+  T_t* p_r = r->array;
+  const size_t n = r->size;
+  // Local copy: the stores in the array can not modify it
+  const gho_divider_t local_divider = *divider;
+  for (size_t i = 0; i < n; ++i) {
+    const gho_ullint v_abs = gho_vector_T_abs_(p_r[i]);
+    const bool is_negative = gho_vector_T_is_negative_(p_r[i]);
+    p_r[i] = (T_t)gho_divider_mod_(&local_divider, v_abs, is_negative);
+  }
+}
+
+/**
+ * \brief Return the number of elements divisible by d
+ * \param[in] vector A gho_vector_T
+ * \param[in] d      The divisor (only 0 is divisible by 0)
+ * \return the number of elements divisible by d
+ * @relates gho_vector_T_t
+ */
+size_t gho_vector_T_op_count_divisible(const gho_vector_T_t* const vector,
+                                       const T_t d) {
+  return gho_vector_T_op_divisible_(vector, d, false);
+}
+
+/**
+ * \brief Return true if all the elements are divisible by d
+ * \param[in] vector A gho_vector_T
+ * \param[in] d      The divisor (only 0 is divisible by 0)
+ * \return true if all the elements are divisible by d (true if the vector is
+ *         empty)
+ * @relates gho_vector_T_t
+ */
+bool gho_vector_T_op_all_divisible(const gho_vector_T_t* const vector,
+                                   const T_t d) {
+  return gho_vector_T_op_divisible_(vector, d, true) == vector->size;
+}
+
+/**
+ * \brief Return the number of elements divisible by d
+ * \param[in] vector A gho_vector_T
+ * \param[in] d      The divisor
+ * \param[in] stop   true to stop at the first element not divisible by d
+ * \return the number of elements divisible by d (before the first element not
+ *         divisible by d if stop is true)
+ * \note The division is replaced by a multiplication by the inverse of the
+ *       odd part of |d|, see gho_ullint_inverse_
+ * \warning Do not use this function, use gho_vector_T_op_count_divisible or
+ *          gho_vector_T_op_all_divisible
+ * @relates gho_vector_T_t
+ */
+size_t gho_vector_T_op_divisible_(const gho_vector_T_t* const vector,
+                                  const T_t d, const bool stop) {
+  const T_t* const array = vector->array;
+  const size_t n = vector->size;
+  const gho_ullint d_abs = gho_vector_T_abs_(d);
+  size_t r = 0;
+  // Only 0 is divisible by 0
+  if (d_abs == 0) {
+    for (size_t i = 0; i < n; ++i) {
+      if (array[i] != 0) { if (stop) { break; } }
+      else { ++r; }
+    }
+    return r;
+  }
+  const int k = gho_ullint_ctz_(d_abs);
+  const gho_ullint inverse = gho_ullint_inverse_(d_abs >> k);
+  const gho_ullint limit = ULLONG_MAX / d_abs;
+  for (size_t i = 0; i < n; ++i) {
+    const gho_ullint q = gho_vector_T_abs_(array[i]) * inverse;
+    const bool is_divisible = ((q >> k) | (q << ((64 - k) & 63))) <= limit;
+    if (stop && is_divisible == false) { break; }
+    r += is_divisible;
+  }
+  return r;
+}
+#endif
+
+#if defined(gho_T_integer) && defined(gho_T_gcd)
+/**
+ * \brief Return the greatest common divisor of all the elements
+ * \param[in] vector A gho_vector_T
+ * \return the greatest common divisor of the elements, 0 if the vector is
+ *         empty or if all the elements are 0
+ * @relates gho_vector_T_t
+ */
+T_t gho_vector_T_op_gcd(const gho_vector_T_t* const vector) {
+  T_t r = 0;
+  for (size_t i = 0; i < vector->size; ++i) {
+    r = gho_T_gcd(r, vector->array[i]);
+    // The gcd can not be smaller than 1
+    if (r == 1) { break; }
+  }
+  return r;
+}
+#endif
+
+#if defined(gho_T_integer) && defined(gho_T_lcm)
+/**
+ * \brief Return the least common multiple of all the elements
+ * \param[in] vector A gho_vector_T
+ * \return the least common multiple of the elements, 1 if the vector is
+ *         empty, 0 if an element is 0
+ * \warning The overflows are not detected
+ * @relates gho_vector_T_t
+ */
+T_t gho_vector_T_op_lcm(const gho_vector_T_t* const vector) {
+  T_t r = 1;
+  for (size_t i = 0; i < vector->size; ++i) {
+    r = gho_T_lcm(r, vector->array[i]);
+    // The lcm of 0 and anything is 0
+    if (r == 0) { break; }
+  }
+  return r;
+}
+#endif
+
+#if defined(gho_T_integer) && defined(gho_T_pow_mod)
+/**
+ * \brief r[i] = r[i] ^ e modulo m for all i
+ * \param[in] r A gho_vector_T
+ * \param[in] e The exponent
+ * \param[in] m The modulus (m != 0)
+ * \note The results are in [0, |m|)
+ * @relates gho_vector_T_t
+ */
+void gho_vector_T_op_pow_mod(gho_vector_T_t* r, const gho_ullint e,
+                             const T_t m) {
+  T_t* p_r = r->array;
+  const size_t n = r->size;
+  for (size_t i = 0; i < n; ++i) {
+    p_r[i] = gho_T_pow_mod(p_r[i], e, m);
+  }
 }
 #endif
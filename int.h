@@ -21,6 +21,7 @@
 #include "int/llint.h"
 #include "int/mpz_t.h"
 #include "int/size_t.h"
+#include "int/smpz_t.h"
 #include "int/uint.h"
 #include "int/ulint.h"
 
@@ -21,6 +21,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider int as a class in Doxygen
@@ -58,12 +60,20 @@ void gho_int_sprinti(char** c_str, const int* const i,
                      const unsigned int indent);
 static inline
 void gho_int_sprint(char** c_str, const int* const i);
+static inline
+void gho_int_fwrite_bin(FILE* file, const int* const i);
 
 // Input
 static inline
 int gho_int_fread(FILE* file);
 static inline
 int gho_int_sread(const char** c_str);
+static inline
+int gho_int_rread(gho_reader_t* reader);
+static inline
+int gho_int_fread_bin(FILE* file);
+static inline
+void gho_int_fread_bin_(FILE* file, int* i);
 
 // Copy & comparisons
 static inline
@@ -74,6 +84,8 @@ static inline
 bool gho_int_equal(const int* const a, const int* const b);
 static inline
 int gho_int_compare(const int* const a, const int* const b);
+static inline
+size_t gho_int_hash(const int* const i);
 
 // Conversion
 static inline
@@ -21,6 +21,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider long int as a class in Doxygen
@@ -58,12 +60,20 @@ void gho_lint_sprinti(char** c_str, const gho_lint* const i,
                      const unsigned int indent);
 static inline
 void gho_lint_sprint(char** c_str, const gho_lint* const i);
+static inline
+void gho_lint_fwrite_bin(FILE* file, const gho_lint* const i);
 
 // Input
 static inline
 gho_lint gho_lint_fread(FILE* file);
 static inline
 gho_lint gho_lint_sread(const char** c_str);
+static inline
+gho_lint gho_lint_rread(gho_reader_t* reader);
+static inline
+gho_lint gho_lint_fread_bin(FILE* file);
+static inline
+void gho_lint_fread_bin_(FILE* file, gho_lint* i);
 
 // Copy & comparisons
 static inline
@@ -74,6 +84,8 @@ static inline
 bool gho_lint_equal(const gho_lint* const a, const gho_lint* const b);
 static inline
 int gho_lint_compare(const gho_lint* const a, const gho_lint* const b);
+static inline
+size_t gho_lint_hash(const gho_lint* const i);
 
 // Conversion
 static inline
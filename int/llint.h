@@ -21,6 +21,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider long long int as a class in Doxygen
@@ -58,12 +60,20 @@ void gho_llint_sprinti(char** c_str, const gho_llint* const i,
                      const unsigned int indent);
 static inline
 void gho_llint_sprint(char** c_str, const gho_llint* const i);
+static inline
+void gho_llint_fwrite_bin(FILE* file, const gho_llint* const i);
 
 // Input
 static inline
 gho_llint gho_llint_fread(FILE* file);
 static inline
 gho_llint gho_llint_sread(const char** c_str);
+static inline
+gho_llint gho_llint_rread(gho_reader_t* reader);
+static inline
+gho_llint gho_llint_fread_bin(FILE* file);
+static inline
+void gho_llint_fread_bin_(FILE* file, gho_llint* i);
 
 // Copy & comparisons
 static inline
@@ -74,6 +84,8 @@ static inline
 bool gho_llint_equal(const gho_llint* const a, const gho_llint* const b);
 static inline
 int gho_llint_compare(const gho_llint* const a, const gho_llint* const b);
+static inline
+size_t gho_llint_hash(const gho_llint* const i);
 
 // Conversion
 static inline
@@ -26,6 +26,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../gmp_pool.h"
 #include "lint.h"
 #include "ulint.h"
 
@@ -47,6 +49,8 @@ gho_mpz_t gho_mpz_create();
 static inline
 gho_mpz_t gho_mpz_create_from_gmp(const mpz_t* const gmp_mpz);
 static inline
+gho_mpz_t gho_mpz_create_in_pool(gho_gmp_pool_t* pool, const size_t nb_limb);
+static inline
 void gho_mpz_destroy(gho_mpz_t* i);
 static inline
 void gho_mpz_reset(gho_mpz_t* i);
@@ -64,12 +68,20 @@ void gho_mpz_sprinti(char** c_str, const gho_mpz_t* const i,
                        const unsigned int indent);
 static inline
 void gho_mpz_sprint(char** c_str, const gho_mpz_t* const i);
+static inline
+void gho_mpz_fwrite_bin(FILE* file, const gho_mpz_t* const i);
 
 // Input
 static inline
 gho_mpz_t gho_mpz_fread(FILE* file);
 static inline
 gho_mpz_t gho_mpz_sread(const char** c_str);
+static inline
+gho_mpz_t gho_mpz_rread(gho_reader_t* reader);
+static inline
+gho_mpz_t gho_mpz_fread_bin(FILE* file);
+static inline
+void gho_mpz_fread_bin_(FILE* file, gho_mpz_t* i);
 
 // Copy & comparisons
 static inline
@@ -77,6 +89,9 @@ gho_mpz_t gho_mpz_copy(const gho_mpz_t* const i);
 static inline
 void gho_mpz_copy_(const gho_mpz_t* const i, gho_mpz_t* copy);
 static inline
+gho_mpz_t gho_mpz_copy_in_pool(const gho_mpz_t* const i,
+                               gho_gmp_pool_t* pool);
+static inline
 bool gho_mpz_equal(const gho_mpz_t* const a, const gho_mpz_t* const b);
 static inline
 bool gho_mpz_equal_li(const gho_mpz_t* const a, const gho_lint b);
@@ -84,6 +99,8 @@ static inline
 int gho_mpz_compare(const gho_mpz_t* const a, const gho_mpz_t* const b);
 static inline
 int gho_mpz_compare_li(const gho_mpz_t* const a, const gho_lint b);
+static inline
+size_t gho_mpz_hash(const gho_mpz_t* const i);
 
 // Conversion
 static inline
@@ -22,6 +22,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider size_t as a class in Doxygen
@@ -59,12 +61,20 @@ void gho_size_t_sprinti(char** c_str, const size_t* const i,
                         const unsigned int indent);
 static inline
 void gho_size_t_sprint(char** c_str, const size_t* const i);
+static inline
+void gho_size_t_fwrite_bin(FILE* file, const size_t* const i);
 
 // Input
 static inline
 size_t gho_size_t_fread(FILE* file);
 static inline
 size_t gho_size_t_sread(const char** c_str);
+static inline
+size_t gho_size_t_rread(gho_reader_t* reader);
+static inline
+size_t gho_size_t_fread_bin(FILE* file);
+static inline
+void gho_size_t_fread_bin_(FILE* file, size_t* i);
 
 // Copy & comparisons
 static inline
@@ -75,6 +85,8 @@ static inline
 bool gho_size_t_equal(const size_t* const a, const size_t* const b);
 static inline
 int gho_size_t_compare(const size_t* const a, const size_t* const b);
+static inline
+size_t gho_size_t_hash(const size_t* const i);
 
 // Conversion
 static inline
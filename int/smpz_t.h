@@ -0,0 +1,186 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_INT_SMPZ_T_H
+#define GHO_INT_SMPZ_T_H
+
+#ifdef gho_with_gmp
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmp.h"
+
+#include "../string.h"
+#include "../any.h"
+#include "../binary.h"
+#include "../overflow.h"
+#include "lint.h"
+#include "ulint.h"
+#include "mpz_t.h"
+
+
+/**
+ * \brief Integer stored in a gho_lint while it fits, in a GMP mpz_t otherwise
+ *
+ * The operations are done on the gho_lint with an overflow check; the value is
+ * promoted to a mpz_t (no allocation before) only when a result does not fit.
+ * The additions, subtractions and multiplications demote a result that fits
+ * again in a gho_lint; the other operations keep a promoted value in a mpz_t.
+ */
+typedef struct {
+  
+  /// \brief true if the value is i.big, false if the value is i.small
+  bool is_mpz;
+  
+  /// \brief Value
+  union {
+    /// \brief Small value (is_mpz == false)
+    gho_lint small;
+    /// \brief GMP mpz_t (is_mpz == true)
+    mpz_t big;
+  } i;
+  
+} gho_smpz_t;
+
+
+// Create & destroy
+static inline
+gho_smpz_t gho_smpz_create();
+static inline
+gho_smpz_t gho_smpz_create_from_li(const gho_lint i);
+static inline
+gho_smpz_t gho_smpz_create_from_mpz(const gho_mpz_t* const i);
+static inline
+void gho_smpz_destroy(gho_smpz_t* i);
+static inline
+void gho_smpz_reset(gho_smpz_t* i);
+
+// Output
+static inline
+void gho_smpz_fprinti(FILE* file, const gho_smpz_t* const i,
+                      const unsigned int indent);
+static inline
+void gho_smpz_fprint(FILE* file, const gho_smpz_t* const i);
+static inline
+void gho_smpz_print(const gho_smpz_t* const i);
+static inline
+void gho_smpz_sprinti(char** c_str, const gho_smpz_t* const i,
+                      const unsigned int indent);
+static inline
+void gho_smpz_sprint(char** c_str, const gho_smpz_t* const i);
+static inline
+void gho_smpz_fwrite_bin(FILE* file, const gho_smpz_t* const i);
+
+// Input
+static inline
+gho_smpz_t gho_smpz_fread(FILE* file);
+static inline
+gho_smpz_t gho_smpz_sread(const char** c_str);
+static inline
+gho_smpz_t gho_smpz_rread(gho_reader_t* reader);
+static inline
+gho_smpz_t gho_smpz_fread_bin(FILE* file);
+static inline
+void gho_smpz_fread_bin_(FILE* file, gho_smpz_t* i);
+
+// Copy & comparisons
+static inline
+gho_smpz_t gho_smpz_copy(const gho_smpz_t* const i);
+static inline
+void gho_smpz_copy_(const gho_smpz_t* const i, gho_smpz_t* copy);
+static inline
+bool gho_smpz_equal(const gho_smpz_t* const a, const gho_smpz_t* const b);
+static inline
+bool gho_smpz_equal_li(const gho_smpz_t* const a, const gho_lint b);
+static inline
+int gho_smpz_compare(const gho_smpz_t* const a, const gho_smpz_t* const b);
+static inline
+int gho_smpz_compare_li(const gho_smpz_t* const a, const gho_lint b);
+static inline
+int gho_smpz_compare_mpz(const gho_smpz_t* const a, const gho_mpz_t* const b);
+static inline
+size_t gho_smpz_hash(const gho_smpz_t* const i);
+
+// Conversion
+static inline
+bool gho_smpz_fits_li(const gho_smpz_t* const i);
+static inline
+gho_lint gho_smpz_get_li(const gho_smpz_t* const i);
+static inline
+gho_mpz_t gho_smpz_to_mpz(const gho_smpz_t* const i);
+static inline
+gho_string_t gho_smpz_to_string(const gho_smpz_t* const i);
+static inline
+gho_any_t gho_smpz_to_any(const gho_smpz_t* const i);
+
+// Set
+static inline
+void gho_smpz_set(gho_smpz_t* a, const gho_smpz_t* const b);
+static inline
+void gho_smpz_set_li(gho_smpz_t* a, const gho_lint b);
+static inline
+void gho_smpz_set_mpz(gho_smpz_t* a, const gho_mpz_t* const b);
+
+// Swap
+static inline
+void gho_smpz_swap(gho_smpz_t* a, gho_smpz_t* b);
+
+// Arithmetic
+static inline
+void gho_smpz_promote_(gho_smpz_t* i);
+static inline
+void gho_smpz_demote_(gho_smpz_t* i);
+static inline
+void gho_smpz_add(gho_smpz_t* r, const gho_smpz_t* const i);
+static inline
+void gho_smpz_sub(gho_smpz_t* r, const gho_smpz_t* const i);
+static inline
+void gho_smpz_mul(gho_smpz_t* r, const gho_smpz_t* const i);
+static inline
+void gho_smpz_add_li(gho_smpz_t* r, const gho_lint i);
+static inline
+void gho_smpz_sub_li(gho_smpz_t* r, const gho_lint i);
+static inline
+void gho_smpz_mul_li(gho_smpz_t* r, const gho_lint i);
+static inline
+void gho_smpz_add_mpz(gho_smpz_t* r, const gho_mpz_t* const i);
+static inline
+void gho_smpz_sub_mpz(gho_smpz_t* r, const gho_mpz_t* const i);
+static inline
+void gho_smpz_mul_mpz(gho_smpz_t* r, const gho_mpz_t* const i);
+static inline
+void gho_smpz_neg(gho_smpz_t* i);
+static inline
+void gho_smpz_gcd(gho_smpz_t* r, const gho_smpz_t* const i);
+static inline
+void gho_smpz_gcd_li(gho_smpz_t* r, const gho_lint i);
+static inline
+bool gho_smpz_is_divisible(const gho_smpz_t* const a,
+                           const gho_smpz_t* const b);
+static inline
+bool gho_smpz_is_divisible_li(const gho_smpz_t* const a, const gho_lint b);
+static inline
+void gho_smpz_pow_ui(gho_smpz_t* r, const gho_ulint e);
+static inline
+void gho_smpz_pow_mod(gho_smpz_t* r, const gho_ulint e,
+                      const gho_smpz_t* const m);
+
+#include "../implementation/int/smpz_t.h"
+
+#endif
+
+#endif
@@ -21,6 +21,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider unsigned int as a class in Doxygen
@@ -58,12 +60,20 @@ void gho_uint_sprinti(char** c_str, const gho_uint* const i,
                      const unsigned int indent);
 static inline
 void gho_uint_sprint(char** c_str, const gho_uint* const i);
+static inline
+void gho_uint_fwrite_bin(FILE* file, const gho_uint* const i);
 
 // Input
 static inline
 gho_uint gho_uint_fread(FILE* file);
 static inline
 gho_uint gho_uint_sread(const char** c_str);
+static inline
+gho_uint gho_uint_rread(gho_reader_t* reader);
+static inline
+gho_uint gho_uint_fread_bin(FILE* file);
+static inline
+void gho_uint_fread_bin_(FILE* file, gho_uint* i);
 
 // Copy & comparisons
 static inline
@@ -74,6 +84,8 @@ static inline
 bool gho_uint_equal(const gho_uint* const a, const gho_uint* const b);
 static inline
 int gho_uint_compare(const gho_uint* const a, const gho_uint* const b);
+static inline
+size_t gho_uint_hash(const gho_uint* const i);
 
 // Conversion
 static inline
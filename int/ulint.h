@@ -21,6 +21,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider unsigned long int as a class in Doxygen
@@ -58,12 +60,20 @@ void gho_ulint_sprinti(char** c_str, const gho_ulint* const i,
                       const unsigned int indent);
 static inline
 void gho_ulint_sprint(char** c_str, const gho_ulint* const i);
+static inline
+void gho_ulint_fwrite_bin(FILE* file, const gho_ulint* const i);
 
 // Input
 static inline
 gho_ulint gho_ulint_fread(FILE* file);
 static inline
 gho_ulint gho_ulint_sread(const char** c_str);
+static inline
+gho_ulint gho_ulint_rread(gho_reader_t* reader);
+static inline
+gho_ulint gho_ulint_fread_bin(FILE* file);
+static inline
+void gho_ulint_fread_bin_(FILE* file, gho_ulint* i);
 
 // Copy & comparisons
 static inline
@@ -74,6 +84,8 @@ static inline
 bool gho_ulint_equal(const gho_ulint* const a, const gho_ulint* const b);
 static inline
 int gho_ulint_compare(const gho_ulint* const a, const gho_ulint* const b);
+static inline
+size_t gho_ulint_hash(const gho_ulint* const i);
 
 // Conversion
 static inline
@@ -21,6 +21,8 @@
 
 #include "../string.h"
 #include "../any.h"
+#include "../binary.h"
+#include "../hash.h"
 
 
 // Consider unsigned long long int as a class in Doxygen
@@ -58,12 +60,20 @@ void gho_ullint_sprinti(char** c_str, const gho_ullint* const i,
                       const unsigned int indent);
 static inline
 void gho_ullint_sprint(char** c_str, const gho_ullint* const i);
+static inline
+void gho_ullint_fwrite_bin(FILE* file, const gho_ullint* const i);
 
 // Input
 static inline
 gho_ullint gho_ullint_fread(FILE* file);
 static inline
 gho_ullint gho_ullint_sread(const char** c_str);
+static inline
+gho_ullint gho_ullint_rread(gho_reader_t* reader);
+static inline
+gho_ullint gho_ullint_fread_bin(FILE* file);
+static inline
+void gho_ullint_fread_bin_(FILE* file, gho_ullint* i);
 
 // Copy & comparisons
 static inline
@@ -74,6 +84,8 @@ static inline
 bool gho_ullint_equal(const gho_ullint* const a, const gho_ullint* const b);
 static inline
 int gho_ullint_compare(const gho_ullint* const a, const gho_ullint* const b);
+static inline
+size_t gho_ullint_hash(const gho_ullint* const i);
 
 // Conversion
 static inline
@@ -0,0 +1,82 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_MAPPED_FILE_H
+#define GHO_MAPPED_FILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/**
+ * \brief Read-only view of a whole file in memory
+ *
+ * With gho_unix (detected on Unix-like systems when it is not defined; define
+ * gho_unix to 0 to disable it), the file is mapped with mmap and the chars
+ * are not copied.
+ * Otherwise, the file is read in one allocated array.
+ *
+ * The view is followed by a '\0', so the gho_T_sread functions can parse it
+ * directly (they stop at the '\0', they do not need the end of the view):
+ * @code
+   gho_mapped_file_t file = gho_mapped_file_create("vector.txt");
+   const char* c_str = gho_mapped_file_c_str(&file);
+   gho_vector_int_t vector = gho_vector_int_sread(&c_str);
+   gho_mapped_file_destroy(&file);
+   @endcode
+ */
+typedef struct {
+
+  /// \brief First char of the file
+  const char* c_str;
+
+  /// \brief Size of the file (without the '\0')
+  size_t size;
+
+  /// \brief Memory to be released (mapping or array)
+  void* memory;
+
+  /// \brief Size of the memory to be released
+  size_t memory_size;
+
+  /// \brief True if the memory is a mapping, false if it is an array
+  bool mapped;
+
+} gho_mapped_file_t;
+
+
+// Create & destroy
+static inline
+gho_mapped_file_t gho_mapped_file_create(const char* const path);
+static inline
+void gho_mapped_file_destroy(gho_mapped_file_t* file);
+static inline
+bool gho_mapped_file_map_(gho_mapped_file_t* file, const char* const path);
+
+// Get
+static inline
+const char* gho_mapped_file_c_str(const gho_mapped_file_t* const file);
+static inline
+const char* gho_mapped_file_end(const gho_mapped_file_t* const file);
+
+// Size
+static inline
+size_t gho_mapped_file_size(const gho_mapped_file_t* const file);
+static inline
+bool gho_mapped_file_empty(const gho_mapped_file_t* const file);
+
+#include "implementation/mapped_file.h"
+
+#endif
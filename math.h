@@ -21,8 +21,15 @@
 #include "math_T.h"
 #include "int/lint.h"
 #include "int/llint.h"
+#include "int/ullint.h"
 #include "int/mpz_t.h"
 
+#ifdef __SIZEOF_INT128__
+  // 128-bit product of two gho_ullint (__extension__: no warning with
+  // -pedantic)
+  __extension__ typedef unsigned __int128 gho_uint128_t_;
+#endif
+
 #ifdef gho_with_gmp
 static inline
 gho_mpz_t gho_mpz_abs(const gho_mpz_t i);
@@ -30,6 +37,12 @@ gho_mpz_t gho_mpz_abs(const gho_mpz_t i);
 
 // gcd
 
+static inline
+int gho_ullint_ctz_(const gho_ullint i);
+
+static inline
+gho_ullint gho_ullint_gcd(const gho_ullint a, const gho_ullint b);
+
 static inline
 int gho_int_gcd(const int a, const int b);
 
@@ -49,8 +62,48 @@ static inline
 gho_ulint gho_mpz_gcd_uli(const gho_mpz_t a, const gho_ulint b);
 #endif
 
+// lcm
+
+static inline
+int gho_int_lcm(const int a, const int b);
+
+static inline
+gho_lint gho_lint_lcm(const gho_lint a, const gho_lint b);
+
+static inline
+gho_llint gho_llint_lcm(const gho_llint a, const gho_llint b);
+
+// is_divisible
+
+static inline
+bool gho_ullint_is_divisible(const gho_ullint a, const gho_ullint b);
+
+static inline
+bool gho_int_is_divisible(const int a, const int b);
+
+static inline
+bool gho_lint_is_divisible(const gho_lint a, const gho_lint b);
+
+static inline
+bool gho_llint_is_divisible(const gho_llint a, const gho_llint b);
+
+static inline
+gho_ullint gho_ullint_inverse_(const gho_ullint d);
+
 // log
 
+static inline
+int gho_ullint_clz_(const gho_ullint i);
+
+static inline
+gho_ullint gho_ullint_pow_10_(const int n);
+
+static inline
+gho_ullint gho_ullint_log2(const gho_ullint i);
+
+static inline
+gho_ullint gho_ullint_log10(const gho_ullint i);
+
 static inline
 int gho_int_log2(const int i);
 
@@ -79,6 +132,45 @@ static inline
 gho_mpz_t gho_mpz_log10(const gho_mpz_t i);
 #endif
 
+#ifdef gho_with_gmp
+static inline
+size_t gho_mpz_log10_(const mpz_t i);
+#endif
+
+// pow_10
+
+static inline
+gho_ullint gho_ullint_pow_10_floor(const gho_ullint i);
+
+static inline
+gho_ullint gho_ullint_pow_10_round(const gho_ullint i);
+
+// pow
+
+static inline
+int gho_int_pow(const int a, const gho_ullint e);
+
+static inline
+gho_lint gho_lint_pow(const gho_lint a, const gho_ullint e);
+
+static inline
+gho_llint gho_llint_pow(const gho_llint a, const gho_ullint e);
+
+static inline
+int gho_int_pow_mod(const int a, const gho_ullint e, const int m);
+
+static inline
+gho_lint gho_lint_pow_mod(const gho_lint a, const gho_ullint e,
+                          const gho_lint m);
+
+static inline
+gho_llint gho_llint_pow_mod(const gho_llint a, const gho_ullint e,
+                            const gho_llint m);
+
+static inline
+gho_ullint gho_ullint_mul_mod_(const gho_ullint a, const gho_ullint b,
+                               const gho_ullint m);
+
 #include "implementation/math.h"
 
 #endif
@@ -38,6 +38,15 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_char_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_char_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_char_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_char_copy
 
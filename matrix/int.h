@@ -17,6 +17,7 @@
 #define GHO_MATRIX_INT_H
 
 #include "../int/int.h"
+#include "../math.h"
 
 
 #define gho_matrix_T gho_matrix_int
@@ -38,12 +39,27 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_int_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_int_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_int_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_int_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_int_equal
 
+// T is a machine integer: row operations with native arithmetic
+#define gho_T_integer
+
+// T gho_T_gcd(const T a, const T b);
+#define gho_T_gcd gho_int_gcd
+
 #include "../matrix_T.h"
 
 
@@ -17,6 +17,7 @@
 #define GHO_MATRIX_LLINT_H
 
 #include "../int/llint.h"
+#include "../math.h"
 
 
 #define gho_matrix_T gho_matrix_llint
@@ -38,12 +39,27 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_llint_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_llint_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_llint_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_llint_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_llint_equal
 
+// T is a machine integer: row operations with native arithmetic
+#define gho_T_integer
+
+// T gho_T_gcd(const T a, const T b);
+#define gho_T_gcd gho_llint_gcd
+
 #include "../matrix_T.h"
 
 
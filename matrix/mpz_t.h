@@ -40,12 +40,21 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_mpz_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_mpz_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_mpz_fread_bin
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_mpz_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_mpz_equal
 
+// T is gho_mpz_t: row operations with in-place GMP arithmetic
+#define gho_T_mpz
+
 #include "../matrix_T.h"
 
 #endif
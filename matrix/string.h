@@ -38,6 +38,12 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_string_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_string_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_string_fread_bin
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_string_copy
 
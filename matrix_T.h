@@ -53,12 +53,35 @@
   #error "Please define gho_T_equal before include <gho/matrix_T.h>"
 #endif
 
+// void gho_T_move(T* destination, T* source, const size_t n);
+// Relocate n elements (the arrays can overlap), the source elements are then
+// uninitialized (not destroyed). The default is memmove: all the T of gho can
+// be moved bitwise (they do not point to themselves)
+#ifndef gho_T_move
+  #define gho_T_move(destination, source, n) \
+    memmove((destination), (source), sizeof(T_t) * (n))
+#endif
+
+// Row operations and gho_gmp_pool_t (optional):
+// gho_T_integer: define it if T is a machine integer
+// gho_T_mpz:     define it if T is gho_mpz_t
+// T gho_T_gcd(const T a, const T b); (with gho_T_integer)
+
+// Binary format (optional):
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+// T gho_T_fread_bin(FILE* file);
+// gho_T_bin_block: define it if a T is written as the sizeof(T) bytes of its
+//                  value, the elements are then written and read in blocks
+
 
 #include <stdio.h>
 #include <stddef.h>
 #include <stdbool.h>
 
 #include "any.h"
+#include "memory.h"
+#include "binary.h"
+#include "divider.h"
 
 // http://stackoverflow.com/questions/13842468/comma-in-c-c-macro
 #define COMMA ,
@@ -69,7 +92,10 @@
 
 
 /**
- * \brief Contains an array of array of T
+ * \brief Contains a matrix of T
+ * 
+ * The elements are stored row by row in one contiguous array (data). Two
+ * consecutive rows are separated by nb_col_capacity elements (the stride).
  */
 typedef struct {
   
@@ -82,7 +108,16 @@ typedef struct {
   /// \brief Number of columns
   size_t nb_col;
   
-  /// \brief Array of array of T
+  /// \brief Number of rows allocated
+  size_t nb_row_capacity;
+  
+  /// \brief Number of columns allocated (stride between two rows in data)
+  size_t nb_col_capacity;
+  
+  /// \brief Array of T (nb_row_capacity * nb_col_capacity elements)
+  T_t* data;
+  
+  /// \brief Array of rows: array[i] points on the row i in data
   T_t** array;
   
 } gho_matrix_T_t;
@@ -92,6 +127,8 @@ typedef struct {
 #define gho_matrix_T_create_n_m concat_name(gho_matrix_T COMMA create_n_m)
 #define gho_matrix_T_create_n_m_copy \
   concat_name(gho_matrix_T COMMA create_n_m_copy)
+#define gho_matrix_T_create_n_m_in_pool \
+  concat_name(gho_matrix_T COMMA create_n_m_in_pool)
 #define gho_matrix_T_destroy concat_name(gho_matrix_T COMMA destroy)
 #define gho_matrix_T_reset concat_name(gho_matrix_T COMMA reset)
 static inline
@@ -103,6 +140,13 @@ static inline
 gho_matrix_T_t gho_matrix_T_create_n_m_copy(
                                        const size_t nb_row, const size_t nb_col,
                                        const T_t* const default_value);
+#ifdef gho_T_mpz
+static inline
+gho_matrix_T_t gho_matrix_T_create_n_m_in_pool(
+                                       const size_t nb_row, const size_t nb_col,
+                                       gho_gmp_pool_t* pool,
+                                       const size_t nb_limb);
+#endif
 static inline
 void gho_matrix_T_destroy(gho_matrix_T_t* matrix);
 static inline
@@ -126,16 +170,37 @@ void gho_matrix_T_sprinti(char** c_str, const gho_matrix_T_t* const matrix,
                           const unsigned int indent);
 static inline
 void gho_matrix_T_sprint(char** c_str, const gho_matrix_T_t* const matrix);
+#define gho_matrix_T_fwrite_bin concat_name(gho_matrix_T COMMA fwrite_bin)
+#ifdef gho_T_fwrite_bin
+static inline
+void gho_matrix_T_fwrite_bin(FILE* file, const gho_matrix_T_t* const matrix);
+#endif
+
+// Input
+#define gho_matrix_T_fread_bin concat_name(gho_matrix_T COMMA fread_bin)
+#define gho_matrix_T_fread_bin_ concat_name(gho_matrix_T COMMA fread_bin_)
+#ifdef gho_T_fread_bin
+static inline
+gho_matrix_T_t gho_matrix_T_fread_bin(FILE* file);
+static inline
+void gho_matrix_T_fread_bin_(FILE* file, gho_matrix_T_t* matrix);
+#endif
 
 // Copy & comparisons
 #define gho_matrix_T_copy concat_name(gho_matrix_T COMMA copy)
 #define gho_matrix_T_copy_ concat_name(gho_matrix_T COMMA copy_)
+#define gho_matrix_T_copy_in_pool concat_name(gho_matrix_T COMMA copy_in_pool)
 #define gho_matrix_T_equal concat_name(gho_matrix_T COMMA equal)
 static inline
 gho_matrix_T_t gho_matrix_T_copy(const gho_matrix_T_t* const matrix);
 static inline
 void gho_matrix_T_copy_(const gho_matrix_T_t* const matrix,
                         gho_matrix_T_t* copy);
+#ifdef gho_T_mpz
+static inline
+gho_matrix_T_t gho_matrix_T_copy_in_pool(const gho_matrix_T_t* const matrix,
+                                         gho_gmp_pool_t* pool);
+#endif
 static inline
 bool gho_matrix_T_equal(const gho_matrix_T_t* const a,
                         const gho_matrix_T_t* const b);
@@ -151,23 +216,43 @@ gho_any_t gho_matrix_T_to_any(const gho_matrix_T_t* const matrix);
 // Size
 #define gho_matrix_T_nb_row concat_name(gho_matrix_T COMMA nb_row)
 #define gho_matrix_T_nb_col concat_name(gho_matrix_T COMMA nb_col)
+#define gho_matrix_T_nb_row_capacity \
+  concat_name(gho_matrix_T COMMA nb_row_capacity)
+#define gho_matrix_T_nb_col_capacity \
+  concat_name(gho_matrix_T COMMA nb_col_capacity)
 #define gho_matrix_T_empty concat_name(gho_matrix_T COMMA empty)
+#define gho_matrix_T_reserve concat_name(gho_matrix_T COMMA reserve)
+#define gho_matrix_T_update_array_ \
+  concat_name(gho_matrix_T COMMA update_array_)
 static inline
 size_t gho_matrix_T_nb_row(const gho_matrix_T_t* const matrix);
 static inline
 size_t gho_matrix_T_nb_col(const gho_matrix_T_t* const matrix);
 static inline
+size_t gho_matrix_T_nb_row_capacity(const gho_matrix_T_t* const matrix);
+static inline
+size_t gho_matrix_T_nb_col_capacity(const gho_matrix_T_t* const matrix);
+static inline
 bool gho_matrix_T_empty(const gho_matrix_T_t* const matrix);
+static inline
+void gho_matrix_T_reserve(gho_matrix_T_t* matrix,
+                          const size_t nb_row, const size_t nb_col);
+static inline
+void gho_matrix_T_update_array_(gho_matrix_T_t* matrix);
 
 // Get & Set
 #define gho_matrix_T_at concat_name(gho_matrix_T COMMA at)
 #define gho_matrix_T_set concat_name(gho_matrix_T COMMA set)
+#define gho_matrix_T_row concat_name(gho_matrix_T COMMA row)
 static inline
 const T_t* gho_matrix_T_at(const gho_matrix_T_t* const matrix,
                            const size_t i, const size_t j);
 static inline
 void gho_matrix_T_set(gho_matrix_T_t* matrix, const size_t i, const size_t j,
                       const T_t* const value);
+static inline
+const T_t* gho_matrix_T_row(const gho_matrix_T_t* const matrix,
+                            const size_t i);
 
 // Add & remove
 #define gho_matrix_T_add_row \
@@ -203,6 +288,46 @@ void gho_matrix_T_remove_row(gho_matrix_T_t* matrix, const size_t i);
 static inline
 void gho_matrix_T_remove_col(gho_matrix_T_t* matrix, const size_t j);
 
+// Row operations
+#define gho_matrix_T_swap_rows concat_name(gho_matrix_T COMMA swap_rows)
+#define gho_matrix_T_combine_rows concat_name(gho_matrix_T COMMA combine_rows)
+#define gho_matrix_T_normalize_row \
+  concat_name(gho_matrix_T COMMA normalize_row)
+#define gho_matrix_T_floor_div_q_row \
+  concat_name(gho_matrix_T COMMA floor_div_q_row)
+#define gho_matrix_T_floor_div_r_row \
+  concat_name(gho_matrix_T COMMA floor_div_r_row)
+#define gho_matrix_T_div_exact_row \
+  concat_name(gho_matrix_T COMMA div_exact_row)
+#define gho_matrix_T_mod_row concat_name(gho_matrix_T COMMA mod_row)
+static inline
+void gho_matrix_T_swap_rows(gho_matrix_T_t* matrix,
+                            const size_t i, const size_t j);
+#if defined(gho_T_integer) || defined(gho_T_mpz)
+static inline
+void gho_matrix_T_combine_rows(gho_matrix_T_t* matrix,
+                               const size_t i, const T_t* const a,
+                               const size_t j, const T_t* const b);
+#endif
+#if (defined(gho_T_integer) && defined(gho_T_gcd)) || defined(gho_T_mpz)
+static inline
+void gho_matrix_T_normalize_row(gho_matrix_T_t* matrix, const size_t i);
+#endif
+#ifdef gho_T_integer
+static inline
+void gho_matrix_T_floor_div_q_row(gho_matrix_T_t* matrix, const size_t i,
+                                  const gho_divider_t* const divider);
+static inline
+void gho_matrix_T_floor_div_r_row(gho_matrix_T_t* matrix, const size_t i,
+                                  const gho_divider_t* const divider);
+static inline
+void gho_matrix_T_div_exact_row(gho_matrix_T_t* matrix, const size_t i,
+                                const gho_divider_t* const divider);
+static inline
+void gho_matrix_T_mod_row(gho_matrix_T_t* matrix, const size_t i,
+                          const gho_divider_t* const divider);
+#endif
+
 #include "implementation/matrix_T.h"
 
 
@@ -217,6 +342,25 @@ void gho_matrix_T_remove_col(gho_matrix_T_t* matrix, const size_t j);
 #undef gho_T_sprint
 #undef gho_T_copy
 #undef gho_T_equal
+#undef gho_T_move
+#ifdef gho_T_integer
+  #undef gho_T_integer
+#endif
+#ifdef gho_T_mpz
+  #undef gho_T_mpz
+#endif
+#ifdef gho_T_gcd
+  #undef gho_T_gcd
+#endif
+#ifdef gho_T_fwrite_bin
+  #undef gho_T_fwrite_bin
+#endif
+#ifdef gho_T_fread_bin
+  #undef gho_T_fread_bin
+#endif
+#ifdef gho_T_bin_block
+  #undef gho_T_bin_block
+#endif
 
 #undef concat_name_helper
 #undef concat_name
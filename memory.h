@@ -18,45 +18,232 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
 
 
 /**
  * \defgroup gho_memory gho_memory
  * \brief Memory macros (allocation, swap)
+ *
+ * gho_alloc, gho_array_alloc and gho_array_realloc use the current
+ * gho_allocator_t (malloc by default, see allocator.h for the arena and the
+ * pool). A block remembers its allocator: gho_free can be called after a
+ * change of the current allocator. The current allocator is local to a thread
+ * and shared by all the translation units, as gho_allocator_malloc.
+ *
+ * The memory of gho_malloc starts after a gho_memory_header_t: it must be
+ * freed with gho_free (or with the destroy function of its type), never with
+ * free; and the memory of malloc must not be given to gho_realloc or gho_free,
+ * move it with gho_absorb_malloc first. Without NDEBUG, gho_realloc and
+ * gho_free stop with an error on memory which is not of gho_malloc (64-bit).
+ *
+ * With GCC and Clang (not on Windows), the shared state is defined in each
+ * translation unit as a weak symbol and merged by the linker. With the other
+ * compilers, define gho_global_allocator_implementation before including gho
+ * in exactly one translation unit:
+ * @code
+   // In one file only, before including gho
+   #define gho_global_allocator_implementation
+   @endcode
+ * Define gho_with_local_allocator before including gho to keep a current
+ * allocator and a gho_allocator_malloc by translation unit instead.
  */
 
+#ifndef gho_thread_local
+  /**
+   * \brief Storage class of the thread-local variables
+   *        (can be defined before including gho)
+   * @ingroup gho_memory
+   */
+  #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define gho_thread_local _Thread_local
+  #elif defined(__GNUC__)
+    #define gho_thread_local __thread
+  #elif defined(_MSC_VER)
+    #define gho_thread_local __declspec(thread)
+  #else
+    #define gho_thread_local
+  #endif
+#endif
+
+
+// Allocator
+
+typedef struct gho_allocator_s gho_allocator_t;
+
+/**
+ * \brief Allocator used by gho_malloc, gho_realloc and gho_free
+ *
+ * The functions receive and return whole blocks (a gho_memory_header_t
+ * followed by the memory of the user). The counters are updated by gho_malloc,
+ * gho_realloc and gho_free; they are updated with atomic operations when
+ * atomic_counters is true (gho_allocator_malloc, which can be used by several
+ * threads at once, GCC and Clang only).
+ * @ingroup gho_memory
+ */
+struct gho_allocator_s {
+  
+  /// \brief Allocate a block of size bytes (NULL if there is no memory)
+  void* (*alloc_fct)(gho_allocator_t* allocator, const size_t size);
+  
+  /// \brief Reallocate a block (NULL if there is no memory)
+  void* (*realloc_fct)(gho_allocator_t* allocator, void* p,
+                       const size_t old_size, const size_t size);
+  
+  /// \brief Free a block
+  void (*free_fct)(gho_allocator_t* allocator, void* p, const size_t size);
+  
+  /// \brief Number of gho_malloc
+  size_t nb_alloc;
+  
+  /// \brief Number of gho_realloc
+  size_t nb_realloc;
+  
+  /// \brief Number of gho_free
+  size_t nb_free;
+  
+  /// \brief Size allocated and not freed (bytes)
+  size_t size;
+  
+  /// \brief Maximum of size (bytes)
+  size_t size_max;
+  
+  /// \brief True if the counters are updated with atomic operations
+  bool atomic_counters;
+  
+};
+
+/**
+ * \brief Header before each block of gho_malloc
+ * @ingroup gho_memory
+ */
+typedef union {
+  
+  /// \brief Allocator of the block and size asked
+  struct {
+    /// \brief Allocator of the block (used by gho_realloc and gho_free)
+    gho_allocator_t* allocator;
+    /// \brief Size asked (bytes), tagged in the 16 high bits (64-bit)
+    size_t size;
+  } info;
+  
+  /// \brief Alignment of the memory after the header (as malloc)
+  long double alignment;
+  
+} gho_memory_header_t;
+
+static inline
+void* gho_allocator_malloc_alloc_(gho_allocator_t* allocator,
+                                  const size_t size);
+static inline
+void* gho_allocator_malloc_realloc_(gho_allocator_t* allocator, void* p,
+                                    const size_t old_size, const size_t size);
+static inline
+void gho_allocator_malloc_free_(gho_allocator_t* allocator, void* p,
+                                const size_t size);
+static inline
+gho_allocator_t gho_allocator_create(
+  void* (*alloc_fct)(gho_allocator_t* allocator, const size_t size),
+  void* (*realloc_fct)(gho_allocator_t* allocator, void* p,
+                       const size_t old_size, const size_t size),
+  void (*free_fct)(gho_allocator_t* allocator, void* p, const size_t size));
+static inline
+gho_allocator_t* gho_allocator_malloc();
+static inline
+gho_allocator_t** gho_allocator_current_();
+static inline
+gho_allocator_t* gho_allocator();
+static inline
+void gho_allocator_count_(gho_allocator_t* allocator, size_t* counter,
+                          const size_t old_size, const size_t size);
+static inline
+size_t gho_allocator_counter_(const gho_allocator_t* const allocator,
+                              const size_t* const counter);
+static inline
+gho_allocator_t* gho_allocator_set(gho_allocator_t* allocator);
+static inline
+void gho_allocator_reset_counters(gho_allocator_t* allocator);
+static inline
+void gho_allocator_fprint_counters(FILE* file,
+                                   const gho_allocator_t* const allocator);
+
+// Allocation
+static inline
+size_t gho_memory_size_(const char* const fonction_name,
+                        const gho_memory_header_t* const header);
+static inline
+void* gho_malloc(const size_t size);
+static inline
+void* gho_realloc(void* p, const size_t size);
+static inline
+void gho_free(void* p);
+static inline
+void* gho_absorb_malloc(void* p, const size_t size);
 
 // Alloc & array alloc
 
 /**
  * \brief Allocate a type
  * \param[in] type Type
- * \return a allocated type*
+ * \return a allocated type* (free it with gho_free)
  * @ingroup gho_memory
  */
 #define gho_alloc(type) \
-  (type*)malloc(sizeof(type))
+  (type*)gho_malloc(sizeof(type))
 
 /**
  * \brief Allocate a array
  * \param[in] type Type
  * \param[in] n    Array size
- * \return a allocated type [n]
+ * \return a allocated type [n] (free it with gho_free)
  * @ingroup gho_memory
  */
 #define gho_array_alloc(type, n) \
-  (type*)malloc(sizeof(type) * n)
+  (type*)gho_malloc(sizeof(type) * (n))
 
 /**
  * \brief Reallocate a array
  * \param[in] pointer Previous array allocation
  * \param[in] type    Type
  * \param[in] n       Array new size
- * \return a allocated type [n]
+ * \return a allocated type [n] (free it with gho_free)
  * @ingroup gho_memory
  */
 #define gho_array_realloc(pointer, type, n) \
-  pointer = (type*)realloc(pointer, sizeof(type) * n)
+  pointer = (type*)gho_realloc(pointer, sizeof(type) * (n))
+
+// Growth
+
+#ifndef gho_growth_numerator
+  /**
+   * \brief Numerator of the growth factor of dynamic arrays
+   *        (can be defined before including gho)
+   * @ingroup gho_memory
+   */
+  #define gho_growth_numerator 3
+#endif
+
+#ifndef gho_growth_denominator
+  /**
+   * \brief Denominator of the growth factor of dynamic arrays
+   *        (can be defined before including gho)
+   * @ingroup gho_memory
+   */
+  #define gho_growth_denominator 2
+#endif
+
+#ifndef gho_growth_min_capacity
+  /**
+   * \brief Minimal capacity of a dynamic array which grows
+   *        (can be defined before including gho)
+   * @ingroup gho_memory
+   */
+  #define gho_growth_min_capacity 10
+#endif
+
+static inline
+size_t gho_growth(const size_t capacity, const size_t n);
 
 // Swap
 
@@ -75,4 +262,6 @@
     b = tmp; \
   }
 
+#include "implementation/memory.h"
+
 #endif
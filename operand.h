@@ -23,6 +23,7 @@
 #include "type.h"
 #include "int.h"
 #include "string.h"
+#include "overflow.h"
 
 
 /**
@@ -53,6 +54,26 @@ typedef struct {
 } gho_coperand_t;
 
 
+/**
+ * \brief Function called when an operator on machine integers overflows
+ *        (gho_add, gho_sub, gho_mul, gho_pow, gho_pow_mod, gho_pow_10_*)
+ *
+ * It receives the name of the operator and the operands before the
+ * operation. If it returns, the operation is not done: r is unchanged (the
+ * function can modify it, for example to saturate the value).
+ *
+ * The function is shared by all the translation units (as the current
+ * allocator, see memory.h): with GCC and Clang (not on Windows), nothing has
+ * to be done; with the other compilers, define
+ * gho_global_overflow_fct_implementation before including gho in exactly one
+ * translation unit. Define gho_with_local_overflow_fct to keep a function by
+ * translation unit instead.
+ */
+typedef void (*gho_operand_overflow_fct_t)(const char* const function_name,
+                                           const gho_operand_t r,
+                                           const gho_operand_t i);
+
+
 // Create & destroy
 // gho_operand_t
 static inline
@@ -117,7 +138,16 @@ gho_string_t gho_operand_to_string(const gho_operand_t* const i);
 static inline
 gho_string_t gho_coperand_to_string(const gho_coperand_t* const i);
 
-// Binary operators: + - * / % pow gcd
+// Overflow
+static inline
+void gho_operand_set_overflow_fct(const gho_operand_overflow_fct_t fct);
+static inline
+gho_operand_overflow_fct_t gho_operand_overflow_fct();
+static inline
+void gho_operand_overflow_error(const char* const function_name,
+                                const gho_operand_t r, const gho_operand_t i);
+
+// Binary operators: + - * / % pow gcd pow_mod
 static inline
 void gho_add(gho_operand_t r, const gho_operand_t i);
 static inline
@@ -136,8 +166,12 @@ static inline
 void gho_pow(gho_operand_t r, const gho_operand_t i);
 static inline
 void gho_gcd(gho_operand_t r, const gho_operand_t i);
+static inline
+void gho_pow_mod(gho_operand_t r, const gho_operand_t i,
+                 const gho_operand_t m);
 
-// Binary operators with immediate: + - * / % pow gcd with gho_llint immediate
+// Binary operators with immediate: + - * / % pow gcd pow_mod with gho_llint
+// immediate
 static inline
 void gho_add_lli(gho_operand_t r, const gho_llint i);
 static inline
@@ -156,6 +190,8 @@ static inline
 void gho_pow_lli(gho_operand_t r, const gho_llint i);
 static inline
 void gho_gcd_lli(gho_operand_t r, const gho_llint i);
+static inline
+void gho_pow_mod_lli(gho_operand_t r, const gho_llint i, const gho_llint m);
 
 // Unary operators: ++ -- -
 static inline
@@ -268,6 +304,12 @@ static inline
 void gho_pow_10_floor(gho_operand_t i);
 static inline
 void gho_pow_10_round(gho_operand_t i);
+static inline
+void gho_pow_10_(gho_operand_t i, const bool round);
+#ifdef gho_with_gmp
+static inline
+void gho_mpz_pow_10_(mpz_t i, const bool round);
+#endif
 
 // Other functions: is_divisible size_in_base
 // gho_operand_t
@@ -276,6 +318,8 @@ void gho_op_swap(const gho_operand_t a, const gho_operand_t b);
 static inline
 bool gho_op_is_divisible(const gho_operand_t a, const gho_operand_t b);
 static inline
+bool gho_op_is_divisible_lli(const gho_operand_t a, const gho_llint b);
+static inline
 size_t gho_op_size_in_base_2(gho_operand_t i);
 static inline
 size_t gho_op_size_in_base_10(gho_operand_t i);
@@ -283,6 +327,14 @@ size_t gho_op_size_in_base_10(gho_operand_t i);
 static inline
 bool gho_cop_is_divisible(const gho_coperand_t a, const gho_coperand_t b);
 static inline
+bool gho_cop_is_divisible_lli(const gho_coperand_t a, const gho_llint b);
+static inline
+bool gho_coperand_is_integer_(const gho_coperand_t i);
+#ifdef gho_with_gmp
+static inline
+mpz_srcptr gho_coperand_mpz_(const gho_coperand_t i);
+#endif
+static inline
 size_t gho_cop_size_in_base_2(gho_coperand_t i);
 static inline
 size_t gho_cop_size_in_base_10(gho_coperand_t i);
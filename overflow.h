@@ -0,0 +1,97 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_OVERFLOW_H
+#define GHO_OVERFLOW_H
+
+#include <stdbool.h>
+
+#include "int/int.h"
+#include "int/lint.h"
+#include "int/llint.h"
+#include "int/ullint.h"
+
+
+/**
+ * \defgroup gho_overflow gho_overflow
+ * \brief Checked arithmetic
+ *
+ * The gho_*_add_overflow, gho_*_sub_overflow and gho_*_mul_overflow
+ * functions compute a op b in *r and return true if the exact result does not
+ * fit in *r (*r is then the result modulo 2^n).
+ * They use __builtin_add_overflow, __builtin_sub_overflow and
+ * __builtin_mul_overflow when the compiler has them (GCC >= 5, Clang), one
+ * operation and one test of the overflow flag, and portable comparisons
+ * otherwise.
+ * The gho_*_pow_overflow functions compute a^e by squaring (O(log(e))
+ * checked multiplications).
+ */
+
+
+/**
+ * \brief Defined if the compiler has __builtin_add_overflow,
+ *        __builtin_sub_overflow and __builtin_mul_overflow
+ * @ingroup gho_overflow
+ */
+#if defined(__clang__)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_add_overflow) && \
+        __has_builtin(__builtin_sub_overflow) && \
+        __has_builtin(__builtin_mul_overflow)
+      #define gho_with_builtin_overflow
+    #endif
+  #endif
+#elif defined(__GNUC__) && __GNUC__ >= 5
+  #define gho_with_builtin_overflow
+#endif
+
+
+// int
+static inline
+bool gho_int_add_overflow(const gho_llint a, const gho_llint b, int* r);
+static inline
+bool gho_int_sub_overflow(const gho_llint a, const gho_llint b, int* r);
+static inline
+bool gho_int_mul_overflow(const gho_llint a, const gho_llint b, int* r);
+static inline
+bool gho_int_pow_overflow(const gho_llint a, const gho_ullint e, int* r);
+
+// gho_lint
+static inline
+bool gho_lint_add_overflow(const gho_llint a, const gho_llint b, gho_lint* r);
+static inline
+bool gho_lint_sub_overflow(const gho_llint a, const gho_llint b, gho_lint* r);
+static inline
+bool gho_lint_mul_overflow(const gho_llint a, const gho_llint b, gho_lint* r);
+static inline
+bool gho_lint_pow_overflow(const gho_llint a, const gho_ullint e, gho_lint* r);
+
+// gho_llint
+static inline
+bool gho_llint_add_overflow(const gho_llint a, const gho_llint b,
+                            gho_llint* r);
+static inline
+bool gho_llint_sub_overflow(const gho_llint a, const gho_llint b,
+                            gho_llint* r);
+static inline
+bool gho_llint_mul_overflow(const gho_llint a, const gho_llint b,
+                            gho_llint* r);
+static inline
+bool gho_llint_pow_overflow(const gho_llint a, const gho_ullint e,
+                            gho_llint* r);
+
+#include "implementation/overflow.h"
+
+#endif
@@ -0,0 +1,104 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_READER_H
+#define GHO_READER_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+#ifndef gho_reader_block_size
+  /**
+   * \brief Number of bytes read from the file at once by a gho_reader_t
+   * \note Define it before including gho to change it
+   */
+  #define gho_reader_block_size 65536
+#endif
+
+
+/**
+ * \brief Buffered reader on a C file
+ *
+ * The file is read by blocks of gho_reader_block_size bytes. The chars not
+ * read yet are data[begin, end), data[end] is always '\0'. A line or a token
+ * can be peeked: it is kept in the buffer (which grows if needed) and nothing
+ * is pushed back into the file.
+ */
+typedef struct {
+
+  /// \brief C file (NULL when the reader is destroyed)
+  FILE* file;
+
+  /// \brief Buffer (capacity + 1 chars)
+  char* data;
+
+  /// \brief Index of the next char to be read
+  size_t begin;
+
+  /// \brief Index after the last char in the buffer
+  size_t end;
+
+  /// \brief Number of chars that can be stored in the buffer
+  size_t capacity;
+
+  /// \brief True when the end of the file is reached
+  bool eof;
+
+} gho_reader_t;
+
+
+// Create & destroy
+static inline
+gho_reader_t gho_reader_create(FILE* file);
+static inline
+void gho_reader_destroy(gho_reader_t* reader);
+
+// Size
+static inline
+size_t gho_reader_size(const gho_reader_t* const reader);
+static inline
+bool gho_reader_eof(gho_reader_t* reader);
+
+// Buffer
+static inline
+bool gho_reader_fill(gho_reader_t* reader);
+static inline
+const char* gho_reader_data(const gho_reader_t* const reader);
+static inline
+void gho_reader_advance(gho_reader_t* reader, const size_t n);
+
+// Read
+static inline
+int gho_reader_peek(gho_reader_t* reader);
+static inline
+int gho_reader_get(gho_reader_t* reader);
+static inline
+void gho_reader_read_whitespace(gho_reader_t* reader);
+static inline
+size_t gho_reader_find_char(gho_reader_t* reader, const char delimiter);
+static inline
+bool gho_reader_is_token_end_(const char c);
+static inline
+const char* gho_reader_token(gho_reader_t* reader);
+static inline
+const char* gho_reader_word(gho_reader_t* reader);
+static inline
+void gho_reader_set_data(gho_reader_t* reader, const char* const data);
+
+#include "implementation/reader.h"
+
+#endif
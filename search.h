@@ -0,0 +1,71 @@
+// Copyright © 2014-2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_SEARCH_H
+#define GHO_SEARCH_H
+
+#include <stddef.h>
+
+
+/**
+ * \defgroup gho_search gho_search
+ * \brief Search of bytes in bytes (used by the gho_c_str_find and the
+ *        gho_string_find functions)
+ *
+ * gho_search_find filters the candidates on the first and on the last byte of
+ * the needle, 32 (AVX2) or 16 (SSE2) positions at once when the compiler
+ * targets these instruction sets, with memchr otherwise. The needles of at
+ * least gho_search_two_way_size bytes use the Two-Way algorithm (linear time
+ * in the worst case, constant space).
+ */
+
+/**
+ * \brief Size from which a needle is searched with the Two-Way algorithm
+ * @ingroup gho_search
+ */
+#ifndef gho_search_two_way_size
+  #define gho_search_two_way_size 32
+#endif
+
+static inline
+size_t gho_search_find(const char* const haystack, const size_t haystack_size,
+                       const char* const needle, const size_t needle_size);
+static inline
+size_t gho_search_rfind(const char* const haystack, const size_t haystack_size,
+                        const char* const needle, const size_t needle_size);
+static inline
+size_t gho_search_find_char(const char* const haystack,
+                            const size_t haystack_size, const char c);
+static inline
+size_t gho_search_rfind_char(const char* const haystack,
+                             const size_t haystack_size, const char c);
+static inline
+size_t gho_search_count(const char* const haystack, const size_t haystack_size,
+                        const char* const needle, const size_t needle_size);
+
+static inline
+size_t gho_search_find_filter_(const char* const haystack,
+                               const size_t haystack_size,
+                               const char* const needle,
+                               const size_t needle_size);
+static inline
+size_t gho_search_find_two_way_(const char* const haystack,
+                                const size_t haystack_size,
+                                const char* const needle,
+                                const size_t needle_size);
+
+#include "implementation/search.h"
+
+#endif
@@ -22,7 +22,9 @@
 
 #include "string.h"
 #include "any.h"
+#include "binary.h"
 #include "int/size_t.h"
+#include "hash.h"
 
 
 /**
@@ -65,12 +67,22 @@ void gho_start_and_size_sprinti(char** c_str,
 static inline
 void gho_start_and_size_sprint(char** c_str,
                              const gho_start_and_size_t* const start_and_size);
+static inline
+void gho_start_and_size_fwrite_bin(FILE* file,
+                             const gho_start_and_size_t* const start_and_size);
 
 // Input
 static inline
 gho_start_and_size_t gho_start_and_size_fread(FILE* file);
 static inline
 gho_start_and_size_t gho_start_and_size_sread(const char** c_str);
+static inline
+gho_start_and_size_t gho_start_and_size_rread(gho_reader_t* reader);
+static inline
+gho_start_and_size_t gho_start_and_size_fread_bin(FILE* file);
+static inline
+void gho_start_and_size_fread_bin_(FILE* file,
+                                   gho_start_and_size_t* start_and_size);
 
 // Copy & comparisons
 static inline
@@ -82,6 +94,8 @@ void gho_start_and_size_copy_(const gho_start_and_size_t* const start_and_size,
 static inline
 bool gho_start_and_size_equal(const gho_start_and_size_t* const a,
                               const gho_start_and_size_t* const b);
+static inline
+size_t gho_start_and_size_hash(const gho_start_and_size_t* const start_and_size);
 
 // Conversion
 static inline
@@ -20,15 +20,30 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "reader.h"
+#include "binary.h"
+#include "hash.h"
+#include "search.h"
+
 
 /**
  * \brief Contains a C string
+ *
+ * The size and the capacity are stored: gho_string_size is constant time and
+ * adding chars at the end is amortized constant time (geometric growth), so a
+ * gho_string_t can be used to build a long string piece by piece.
  */
 typedef struct {
   
-  /// \brief String ('\0' terminated string)
+  /// \brief String ('\0' terminated string, memory of gho_malloc)
   char* c_str;
   
+  /// \brief Number of chars (without the '\0')
+  size_t size;
+  
+  /// \brief Number of chars that can be stored without reallocation
+  size_t capacity;
+  
 } gho_string_t;
 
 
@@ -42,6 +57,9 @@ void gho_string_absorb(gho_string_t* string, gho_string_t* string_moved);
 static inline
 void gho_string_absorb_c_str(gho_string_t* string, char** c_str_moved);
 static inline
+void gho_string_absorb_malloc_c_str(gho_string_t* string,
+                                    char** c_str_moved);
+static inline
 void gho_string_destroy(gho_string_t* string);
 static inline
 void gho_string_reset(gho_string_t* string);
@@ -59,12 +77,20 @@ void gho_string_sprinti(char** c_str, const gho_string_t* const string,
                         const unsigned int indent);
 static inline
 void gho_string_sprint(char** c_str, const gho_string_t* const string);
+static inline
+void gho_string_fwrite_bin(FILE* file, const gho_string_t* const string);
 
 // Input
 static inline
 gho_string_t gho_string_fread(FILE* file);
 static inline
 gho_string_t gho_string_sread(const char** c_str);
+static inline
+gho_string_t gho_string_rread(gho_reader_t* reader);
+static inline
+gho_string_t gho_string_fread_bin(FILE* file);
+static inline
+void gho_string_fread_bin_(FILE* file, gho_string_t* string);
 
 // Copy & comparisons
 static inline
@@ -79,6 +105,8 @@ bool gho_string_equal_c_str(const gho_string_t* const a, const char* const b);
 static inline
 int gho_string_compare(const gho_string_t* const a,
                        const gho_string_t* const b);
+static inline
+size_t gho_string_hash(const gho_string_t* const string);
 
 // Conversion
 static inline
@@ -91,6 +119,12 @@ static inline
 size_t gho_string_size(const gho_string_t* const string);
 static inline
 bool gho_string_empty(const gho_string_t* const string);
+static inline
+size_t gho_string_capacity(const gho_string_t* const string);
+static inline
+void gho_string_reserve(gho_string_t* string, const size_t capacity);
+static inline
+void gho_string_grow(gho_string_t* string, const size_t n);
 
 // Get & Set
 static inline
@@ -107,6 +141,12 @@ void gho_string_add_char(gho_string_t* string, const char to_be_added);
 static inline
 void gho_string_add_c_str(gho_string_t* string, const char* const to_be_added);
 static inline
+void gho_string_add_c_str_n(gho_string_t* string,
+                            const char* const to_be_added, const size_t n);
+static inline
+void gho_string_add_char_n(gho_string_t* string, const char to_be_added,
+                           const size_t n);
+static inline
 void gho_string_add_char_i(gho_string_t* string, const char to_be_added,
                            const size_t i);
 
@@ -134,6 +174,21 @@ static inline
 size_t gho_string_find_char(const gho_string_t* const string,
                             const char value);
 static inline
+size_t gho_string_find_from(const gho_string_t* const string,
+                            const gho_string_t* const value, const size_t i);
+static inline
+size_t gho_string_rfind(const gho_string_t* const string,
+                        const gho_string_t* const value);
+static inline
+size_t gho_string_rfind_c_str(const gho_string_t* const string,
+                              const char* const value);
+static inline
+size_t gho_string_rfind_char(const gho_string_t* const string,
+                             const char value);
+static inline
+size_t gho_string_count(const gho_string_t* const string,
+                        const gho_string_t* const value);
+static inline
 bool gho_string_contains(const gho_string_t* const string,
                          const gho_string_t* const value);
 static inline
@@ -168,6 +223,21 @@ void gho_string_ignore_line_from_c_str_delimiter(const char** c_str,
 static inline
 gho_string_t gho_string_peek_line_from_c_str_delimiter(const char** c_str,
                                                        const char delimiter);
+static inline
+gho_string_t gho_string_get_line_from_reader(gho_reader_t* reader);
+static inline
+void gho_string_ignore_line_from_reader(gho_reader_t* reader);
+static inline
+gho_string_t gho_string_peek_line_from_reader(gho_reader_t* reader);
+static inline
+gho_string_t gho_string_get_line_from_reader_delimiter(gho_reader_t* reader,
+                                                       const char delimiter);
+static inline
+void gho_string_ignore_line_from_reader_delimiter(gho_reader_t* reader,
+                                                  const char delimiter);
+static inline
+gho_string_t gho_string_peek_line_from_reader_delimiter(gho_reader_t* reader,
+                                                        const char delimiter);
 
 #include "implementation/string.h"
 
@@ -93,7 +93,17 @@ typedef enum {
   GHO_TYPE_OSL_EXTENSION_COMMENTS,
   GHO_TYPE_OSL_EXTENSION_COORDINATES,
   GHO_TYPE_OSL_EXTENSION_SCATNAMES,
-  GHO_TYPE_OSL_EXTENSION_UNKNOWN
+  GHO_TYPE_OSL_EXTENSION_UNKNOWN,
+  
+  // Types added later are appended: the values of gho_type_t are stored in
+  // the binary files (see binary.h) and must not change
+  
+  // gho int
+  GHO_TYPE_GHO_SMPZ_T,
+  // gho matrix
+  GHO_TYPE_MATRIX_SMPZ_T,
+  // gho vector
+  GHO_TYPE_VECTOR_SMPZ_T
   
 } gho_type_t;
 
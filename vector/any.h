@@ -17,6 +17,7 @@
 #define GHO_VECTOR_ANY_H
 
 #include "../any.h"
+#include "../any_bin.h"
 
 
 #define gho_vector_T gho_vector_any
@@ -38,6 +39,12 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_any_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_any_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_any_fread_bin
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_any_copy
 
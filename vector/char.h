@@ -16,6 +16,8 @@
 #ifndef GHO_VECTOR_CHAR_H
 #define GHO_VECTOR_CHAR_H
 
+#include <limits.h>
+
 #include "../char.h"
 
 
@@ -44,15 +46,35 @@
 // T gho_T_sread(char**);
 #define gho_T_sread gho_char_sread
 
+// T gho_T_rread(gho_reader_t* reader);
+#define gho_T_rread gho_char_rread
+
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_char_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_char_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_char_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_char_equal
 
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_char_hash
+
 // int gho_T_compare(const T* const a, const T* const b);
 #define gho_T_compare gho_char_compare
 
+// unsigned long long gho_T_radix_key(const T t);
+#define gho_T_radix_key(t) \
+  ((unsigned long long)(unsigned char)((unsigned char)(t) ^ \
+                                       (CHAR_MIN < 0 ? 0x80u : 0u)))
+
 #include "../vector_T.h"
 
 
@@ -16,7 +16,10 @@
 #ifndef GHO_VECTOR_LLINT_H
 #define GHO_VECTOR_LLINT_H
 
+#include <limits.h>
+
 #include "../int/llint.h"
+#include "../math.h"
 
 
 #define gho_vector_T gho_vector_llint
@@ -44,15 +47,46 @@
 // T gho_T_sread(char**);
 #define gho_T_sread gho_llint_sread
 
+// T gho_T_rread(gho_reader_t* reader);
+#define gho_T_rread gho_llint_rread
+
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_llint_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_llint_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_llint_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_llint_equal
 
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_llint_hash
+
 // int gho_T_compare(const T* const a, const T* const b);
 #define gho_T_compare gho_llint_compare
 
+// unsigned long long gho_T_radix_key(const T t);
+#define gho_T_radix_key(t) \
+  ((unsigned long long)(t) ^ (unsigned long long)LLONG_MIN)
+
+// T is a machine integer: gho_vector_T_op_* are available
+#define gho_T_integer
+
+// T gho_T_gcd(const T a, const T b);
+#define gho_T_gcd gho_llint_gcd
+
+// T gho_T_lcm(const T a, const T b);
+#define gho_T_lcm gho_llint_lcm
+
+// T gho_T_pow_mod(const T a, const gho_ullint e, const T m);
+#define gho_T_pow_mod gho_llint_pow_mod
+
 #include "../vector_T.h"
 
 
@@ -44,18 +44,56 @@
 // T gho_T_sread(char**);
 #define gho_T_sread gho_size_t_sread
 
+// T gho_T_rread(gho_reader_t* reader);
+#define gho_T_rread gho_size_t_rread
+
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_size_t_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_size_t_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_size_t_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_size_t_equal
 
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_size_t_hash
+
 // int gho_T_compare(const T* const a, const T* const b);
 #define gho_T_compare gho_size_t_compare
 
+// unsigned long long gho_T_radix_key(const T t);
+#define gho_T_radix_key(t) ((unsigned long long)(t))
+
+// T is a machine integer: gho_vector_T_op_* are available
+#define gho_T_integer
+
 #include "../vector_T.h"
 
 
+// Find
+
+static inline
+gho_vector_size_t_t gho_vector_size_t_find_all_(const char* const haystack,
+                                                const size_t haystack_size,
+                                                const char* const needle,
+                                                const size_t needle_size);
+static inline
+gho_vector_size_t_t gho_c_str_find_all(const char* const c_str,
+                                       const char* const value);
+static inline
+gho_vector_size_t_t gho_string_find_all(const gho_string_t* const string,
+                                        const gho_string_t* const value);
+
+#include "../implementation/vector/size_t.h"
+
+
 #ifdef DOXYGEN
 /**
  * @brief Vector of size_t
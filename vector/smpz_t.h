@@ -0,0 +1,84 @@
+// Copyright © 2015 Inria, Written by Lénaïc Bagnères, lenaic.bagneres@inria.fr
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef GHO_VECTOR_SMPZ_H
+#define GHO_VECTOR_SMPZ_H
+
+#ifdef gho_with_gmp
+
+#include "../int/smpz_t.h"
+
+
+#define gho_vector_T gho_vector_smpz
+#define gho_vector_T_t gho_vector_smpz_t
+
+#define T_t gho_smpz_t
+
+#define gho_type_vector_T GHO_TYPE_VECTOR_SMPZ_T
+
+// T gho_T_create();
+#define gho_T_create gho_smpz_create
+
+/// void gho_T_destroy(T* t);
+#define gho_T_destroy gho_smpz_destroy
+
+// void gho_T_fprint(FILE* file, const T* const t);
+#define gho_T_fprint gho_smpz_fprint
+
+// void gho_T_sprint(char** c_str, const T* const t);
+#define gho_T_sprint gho_smpz_sprint
+
+// T gho_T_fread(FILE* file);
+#define gho_T_fread gho_smpz_fread
+
+// T gho_T_sread(char**);
+#define gho_T_sread gho_smpz_sread
+
+// T gho_T_rread(gho_reader_t* reader);
+#define gho_T_rread gho_smpz_rread
+
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_smpz_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_smpz_fread_bin
+
+// T gho_T_copy(const T* const t);
+#define gho_T_copy gho_smpz_copy
+
+// bool gho_T_equal(const T* const a, const T* const b);
+#define gho_T_equal gho_smpz_equal
+
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_smpz_hash
+
+// int gho_T_compare(const T* const a, const T* const b);
+#define gho_T_compare gho_smpz_compare
+
+#include "../vector_T.h"
+
+#endif
+
+
+#ifdef DOXYGEN
+/**
+ * @brief Vector of gho_smpz_t (gho_lint or GMP mpz_t)
+ * 
+ * @see gho_vector_T_t for documentation
+ */
+struct gho_vector_smpz_t { };
+#endif
+
+#endif
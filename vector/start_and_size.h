@@ -44,12 +44,24 @@
 // T gho_T_sread(char**);
 #define gho_T_sread gho_start_and_size_sread
 
+// T gho_T_rread(gho_reader_t* reader);
+#define gho_T_rread gho_start_and_size_rread
+
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_start_and_size_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_start_and_size_fread_bin
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_start_and_size_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_start_and_size_equal
 
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_start_and_size_hash
+
 // int gho_T_compare(const T* const a, const T* const b);
 //#define gho_T_compare gho_start_and_size_compare
 
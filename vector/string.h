@@ -38,12 +38,21 @@
 // void gho_T_sprint(char** c_str, const T* const t);
 #define gho_T_sprint gho_string_sprint
 
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_string_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_string_fread_bin
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_string_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_string_equal
 
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_string_hash
+
 // int gho_T_compare(const T* const a, const T* const b);
 #define gho_T_compare gho_string_compare
 
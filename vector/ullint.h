@@ -44,15 +44,36 @@
 // T gho_T_sread(char**);
 #define gho_T_sread gho_ullint_sread
 
+// T gho_T_rread(gho_reader_t* reader);
+#define gho_T_rread gho_ullint_rread
+
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+#define gho_T_fwrite_bin gho_ullint_fwrite_bin
+
+// T gho_T_fread_bin(FILE* file);
+#define gho_T_fread_bin gho_ullint_fread_bin
+
+// T is written as the sizeof(T) bytes of its value
+#define gho_T_bin_block
+
 // T gho_T_copy(const T* const t);
 #define gho_T_copy gho_ullint_copy
 
 // bool gho_T_equal(const T* const a, const T* const b);
 #define gho_T_equal gho_ullint_equal
 
+// size_t gho_T_hash(const T* const t);
+#define gho_T_hash gho_ullint_hash
+
 // int gho_T_compare(const T* const a, const T* const b);
 #define gho_T_compare gho_ullint_compare
 
+// unsigned long long gho_T_radix_key(const T t);
+#define gho_T_radix_key(t) ((unsigned long long)(t))
+
+// T is a machine integer: gho_vector_T_op_* are available
+#define gho_T_integer
+
 #include "../vector_T.h"
 
 
@@ -53,6 +53,44 @@
   #error "Please define gho_T_equal before include <gho/vector_T.h>"
 #endif
 
+// size_t gho_T_growth(const size_t capacity, const size_t n);
+#ifndef gho_T_growth
+  #define gho_T_growth gho_growth
+#endif
+
+// void gho_T_move(T* destination, T* source, const size_t n);
+// Relocate n elements (the arrays can overlap), the source elements are then
+// uninitialized (not destroyed). The default is memmove: all the T of gho can
+// be moved bitwise (they do not point to themselves)
+#ifndef gho_T_move
+  #define gho_T_move(destination, source, n) \
+    memmove((destination), (source), sizeof(T_t) * (n))
+#endif
+
+// Arithmetic (optional):
+// gho_T_integer: define it if T is a machine integer, the element-wise
+//                operations (gho_vector_T_op_*) are then available
+// T gho_T_gcd(const T a, const T b);
+// T gho_T_lcm(const T a, const T b);
+// T gho_T_pow_mod(const T a, const gho_ullint e, const T m);
+
+// Binary format (optional):
+// void gho_T_fwrite_bin(FILE* file, const T* const t);
+// T gho_T_fread_bin(FILE* file);
+// gho_T_bin_block: define it if a T is written as the sizeof(T) bytes of its
+//                  value, the elements are then written and read in blocks
+
+// Hash (optional):
+// size_t gho_T_hash(const T* const t); gho_vector_T_unique is then available
+
+// Sort (optional):
+// int gho_T_compare(const T* const a, const T* const b);
+// unsigned long long gho_T_radix_key(const T t); unsigned key with the order
+//                    of T in its sizeof(T) low bytes, gho_vector_T_radix_sort
+//                    is then available
+// gho_with_pthread: define it before including gho to sort with threads in
+//                   gho_vector_T_parallel_sort (link with -pthread)
+
 
 #include <stdio.h>
 #include <stdbool.h>
@@ -60,6 +98,10 @@
 
 #include "type.h"
 #include "any.h"
+#include "memory.h"
+#include "binary.h"
+#include "int/ullint.h"
+#include "divider.h"
 
 
 // http://stackoverflow.com/questions/13842468/comma-in-c-c-macro
@@ -89,6 +131,32 @@ typedef struct {
   
 } gho_vector_T_t;
 
+#ifdef gho_T_compare
+#define gho_vector_T_sort_task_t_ concat_name(gho_vector_T COMMA sort_task_t_)
+/**
+ * \brief Sort or merge of a part of an array by a thread
+ * \warning Do not use this structure, it is used by gho_vector_T_parallel_sort
+ */
+typedef struct {
+  
+  /// \brief Array sorted or merged
+  T_t* source;
+  
+  /// \brief Result of the merge
+  T_t* destination;
+  
+  /// \brief Begin of the part
+  size_t begin;
+  
+  /// \brief End of the first sorted part (merge)
+  size_t middle;
+  
+  /// \brief End of the part
+  size_t end;
+  
+} gho_vector_T_sort_task_t_;
+#endif
+
 // Create & destroy
 #define gho_vector_T_create concat_name(gho_vector_T COMMA create)
 #define gho_vector_T_create_n concat_name(gho_vector_T COMMA create_n)
@@ -126,10 +194,16 @@ void gho_vector_T_sprinti(char** c_str, const gho_vector_T_t* const vector,
 static inline
 void gho_vector_T_sprint(char** c_str,
                          const gho_vector_T_t* const vector);
+#define gho_vector_T_fwrite_bin concat_name(gho_vector_T COMMA fwrite_bin)
+#ifdef gho_T_fwrite_bin
+static inline
+void gho_vector_T_fwrite_bin(FILE* file, const gho_vector_T_t* const vector);
+#endif
 
 // Input
 #define gho_vector_T_fread concat_name(gho_vector_T COMMA fread)
 #define gho_vector_T_sread concat_name(gho_vector_T COMMA sread)
+#define gho_vector_T_rread concat_name(gho_vector_T COMMA rread)
 #ifdef gho_T_fread
 static inline
 gho_vector_T_t gho_vector_T_fread(FILE* file);
@@ -138,6 +212,18 @@ gho_vector_T_t gho_vector_T_fread(FILE* file);
 static inline
 gho_vector_T_t gho_vector_T_sread(const char** c_str);
 #endif
+#ifdef gho_T_rread
+static inline
+gho_vector_T_t gho_vector_T_rread(gho_reader_t* reader);
+#endif
+#define gho_vector_T_fread_bin concat_name(gho_vector_T COMMA fread_bin)
+#define gho_vector_T_fread_bin_ concat_name(gho_vector_T COMMA fread_bin_)
+#ifdef gho_T_fread_bin
+static inline
+gho_vector_T_t gho_vector_T_fread_bin(FILE* file);
+static inline
+void gho_vector_T_fread_bin_(FILE* file, gho_vector_T_t* vector);
+#endif
 
 // Copy & comparisons
 #define gho_vector_T_copy concat_name(gho_vector_T COMMA copy)
@@ -177,6 +263,7 @@ gho_any_t gho_vector_T_to_any(const gho_vector_T_t* const vector);
 #define gho_vector_T_empty concat_name(gho_vector_T COMMA empty)
 #define gho_vector_T_reserve concat_name(gho_vector_T COMMA reserve)
 #define gho_vector_T_resize concat_name(gho_vector_T COMMA resize)
+#define gho_vector_T_grow concat_name(gho_vector_T COMMA grow)
 static inline
 size_t gho_vector_T_size(const gho_vector_T_t* const vector);
 static inline
@@ -187,6 +274,8 @@ static inline
 void gho_vector_T_reserve(gho_vector_T_t* vector, const size_t n);
 static inline
 void gho_vector_T_resize(gho_vector_T_t* vector, const size_t n);
+static inline
+void gho_vector_T_grow(gho_vector_T_t* vector, const size_t n);
 
 // Get & Set
 #define gho_vector_T_at concat_name(gho_vector_T COMMA at)
@@ -242,6 +331,20 @@ void gho_vector_T_remove_last(gho_vector_T_t* vector);
 #define gho_vector_T_find concat_name(gho_vector_T COMMA find)
 #define gho_vector_T_find_T concat_name(gho_vector_T COMMA find_T)
 #define gho_vector_T_sort concat_name(gho_vector_T COMMA sort)
+#define gho_vector_T_stable_sort concat_name(gho_vector_T COMMA stable_sort)
+#define gho_vector_T_radix_sort concat_name(gho_vector_T COMMA radix_sort)
+#define gho_vector_T_parallel_sort \
+  concat_name(gho_vector_T COMMA parallel_sort)
+#define gho_vector_T_insertion_sort_ \
+  concat_name(gho_vector_T COMMA insertion_sort_)
+#define gho_vector_T_heap_sort_ concat_name(gho_vector_T COMMA heap_sort_)
+#define gho_vector_T_sift_down_ concat_name(gho_vector_T COMMA sift_down_)
+#define gho_vector_T_introsort_ concat_name(gho_vector_T COMMA introsort_)
+#define gho_vector_T_merge_ concat_name(gho_vector_T COMMA merge_)
+#define gho_vector_T_merge_sort_ concat_name(gho_vector_T COMMA merge_sort_)
+#define gho_vector_T_sort_thread_ concat_name(gho_vector_T COMMA sort_thread_)
+#define gho_vector_T_merge_thread_ \
+  concat_name(gho_vector_T COMMA merge_thread_)
 static inline
 size_t gho_vector_T_find(gho_vector_T_t* vector, const T_t* const v);
 static inline
@@ -249,6 +352,161 @@ size_t gho_vector_T_find_T(gho_vector_T_t* vector, const T_t v);
 #ifdef gho_T_compare
 static inline
 void gho_vector_T_sort(gho_vector_T_t* vector);
+static inline
+void gho_vector_T_stable_sort(gho_vector_T_t* vector);
+static inline
+void gho_vector_T_parallel_sort(gho_vector_T_t* vector,
+                                const size_t nb_thread);
+static inline
+void gho_vector_T_insertion_sort_(T_t* array, const size_t n);
+static inline
+void gho_vector_T_heap_sort_(T_t* array, const size_t n);
+static inline
+void gho_vector_T_sift_down_(T_t* array, size_t i, const size_t n);
+static inline
+void gho_vector_T_introsort_(T_t* array, size_t n, size_t depth);
+static inline
+void gho_vector_T_merge_(const T_t* a, const size_t a_size,
+                         const T_t* b, const size_t b_size, T_t* r);
+static inline
+void gho_vector_T_merge_sort_(T_t* array, const size_t n, T_t* buffer);
+#ifdef gho_with_pthread
+static inline
+void* gho_vector_T_sort_thread_(void* task);
+static inline
+void* gho_vector_T_merge_thread_(void* task);
+#endif
+#endif
+#ifdef gho_T_radix_key
+static inline
+void gho_vector_T_radix_sort(gho_vector_T_t* vector);
+#endif
+#define gho_vector_T_lower_bound concat_name(gho_vector_T COMMA lower_bound)
+#define gho_vector_T_upper_bound concat_name(gho_vector_T COMMA upper_bound)
+#define gho_vector_T_binary_find concat_name(gho_vector_T COMMA binary_find)
+#define gho_vector_T_insert_sorted \
+  concat_name(gho_vector_T COMMA insert_sorted)
+#define gho_vector_T_merge_sorted concat_name(gho_vector_T COMMA merge_sorted)
+#define gho_vector_T_set_union concat_name(gho_vector_T COMMA set_union)
+#define gho_vector_T_set_intersection \
+  concat_name(gho_vector_T COMMA set_intersection)
+#define gho_vector_T_set_difference \
+  concat_name(gho_vector_T COMMA set_difference)
+#ifdef gho_T_compare
+static inline
+size_t gho_vector_T_lower_bound(const gho_vector_T_t* const vector,
+                                const T_t* const v);
+static inline
+size_t gho_vector_T_upper_bound(const gho_vector_T_t* const vector,
+                                const T_t* const v);
+static inline
+size_t gho_vector_T_binary_find(const gho_vector_T_t* const vector,
+                                const T_t* const v);
+static inline
+void gho_vector_T_insert_sorted(gho_vector_T_t* vector, const T_t* const v);
+static inline
+gho_vector_T_t gho_vector_T_merge_sorted(const gho_vector_T_t* const a,
+                                         const gho_vector_T_t* const b);
+static inline
+gho_vector_T_t gho_vector_T_set_union(const gho_vector_T_t* const a,
+                                      const gho_vector_T_t* const b);
+static inline
+gho_vector_T_t gho_vector_T_set_intersection(const gho_vector_T_t* const a,
+                                             const gho_vector_T_t* const b);
+static inline
+gho_vector_T_t gho_vector_T_set_difference(const gho_vector_T_t* const a,
+                                           const gho_vector_T_t* const b);
+#endif
+#define gho_vector_T_unique concat_name(gho_vector_T COMMA unique)
+#ifdef gho_T_hash
+static inline
+void gho_vector_T_unique(gho_vector_T_t* vector);
+#endif
+
+// Arithmetic
+#define gho_vector_T_op_add concat_name(gho_vector_T COMMA op_add)
+#define gho_vector_T_op_sub concat_name(gho_vector_T COMMA op_sub)
+#define gho_vector_T_op_mul concat_name(gho_vector_T COMMA op_mul)
+#define gho_vector_T_op_axpy concat_name(gho_vector_T COMMA op_axpy)
+#define gho_vector_T_op_dot concat_name(gho_vector_T COMMA op_dot)
+#define gho_vector_T_op_gcd concat_name(gho_vector_T COMMA op_gcd)
+#define gho_vector_T_op_lcm concat_name(gho_vector_T COMMA op_lcm)
+#define gho_vector_T_op_pow concat_name(gho_vector_T COMMA op_pow)
+#define gho_vector_T_op_pow_mod concat_name(gho_vector_T COMMA op_pow_mod)
+#define gho_vector_T_op_count_divisible \
+  concat_name(gho_vector_T COMMA op_count_divisible)
+#define gho_vector_T_op_all_divisible \
+  concat_name(gho_vector_T COMMA op_all_divisible)
+#define gho_vector_T_op_divisible_ \
+  concat_name(gho_vector_T COMMA op_divisible_)
+#define gho_vector_T_op_check_size_ \
+  concat_name(gho_vector_T COMMA op_check_size_)
+#define gho_vector_T_op_floor_div_q \
+  concat_name(gho_vector_T COMMA op_floor_div_q)
+#define gho_vector_T_op_floor_div_r \
+  concat_name(gho_vector_T COMMA op_floor_div_r)
+#define gho_vector_T_op_div_exact concat_name(gho_vector_T COMMA op_div_exact)
+#define gho_vector_T_op_mod concat_name(gho_vector_T COMMA op_mod)
+#ifdef gho_T_integer
+// x < 0 and |x| as a gho_ullint, for a signed (sign-extended) or unsigned T
+#define gho_vector_T_is_negative_(x) \
+  (((T_t)-1 < (T_t)1) && ((gho_ullint)(x) >> 63))
+#define gho_vector_T_abs_(x) \
+  (gho_vector_T_is_negative_(x) ? -(gho_ullint)(x) : (gho_ullint)(x))
+#endif
+#ifdef gho_T_integer
+static inline
+void gho_vector_T_op_add(gho_vector_T_t* r, const gho_vector_T_t* const v);
+static inline
+void gho_vector_T_op_sub(gho_vector_T_t* r, const gho_vector_T_t* const v);
+static inline
+void gho_vector_T_op_mul(gho_vector_T_t* r, const gho_vector_T_t* const v);
+static inline
+void gho_vector_T_op_axpy(gho_vector_T_t* r, const T_t a,
+                          const gho_vector_T_t* const x);
+static inline
+T_t gho_vector_T_op_dot(const gho_vector_T_t* const a,
+                        const gho_vector_T_t* const b);
+static inline
+void gho_vector_T_op_pow(gho_vector_T_t* r, const gho_ullint e);
+static inline
+size_t gho_vector_T_op_count_divisible(const gho_vector_T_t* const vector,
+                                       const T_t d);
+static inline
+bool gho_vector_T_op_all_divisible(const gho_vector_T_t* const vector,
+                                   const T_t d);
+static inline
+void gho_vector_T_op_floor_div_q(gho_vector_T_t* r,
+                                 const gho_divider_t* const divider);
+static inline
+void gho_vector_T_op_floor_div_r(gho_vector_T_t* r,
+                                 const gho_divider_t* const divider);
+static inline
+void gho_vector_T_op_div_exact(gho_vector_T_t* r,
+                               const gho_divider_t* const divider);
+static inline
+void gho_vector_T_op_mod(gho_vector_T_t* r,
+                         const gho_divider_t* const divider);
+static inline
+size_t gho_vector_T_op_divisible_(const gho_vector_T_t* const vector,
+                                  const T_t d, const bool stop);
+static inline
+void gho_vector_T_op_check_size_(const char* const function_name,
+                                 const gho_vector_T_t* const a,
+                                 const gho_vector_T_t* const b);
+#endif
+#if defined(gho_T_integer) && defined(gho_T_gcd)
+static inline
+T_t gho_vector_T_op_gcd(const gho_vector_T_t* const vector);
+#endif
+#if defined(gho_T_integer) && defined(gho_T_lcm)
+static inline
+T_t gho_vector_T_op_lcm(const gho_vector_T_t* const vector);
+#endif
+#if defined(gho_T_integer) && defined(gho_T_pow_mod)
+static inline
+void gho_vector_T_op_pow_mod(gho_vector_T_t* r, const gho_ullint e,
+                             const T_t m);
 #endif
 
 #include "implementation/vector_T.h"
@@ -269,11 +527,45 @@ void gho_vector_T_sort(gho_vector_T_t* vector);
 #ifdef gho_T_sread
   #undef gho_T_sread
 #endif
+#ifdef gho_T_rread
+  #undef gho_T_rread
+#endif
+#ifdef gho_T_integer
+  #undef gho_T_integer
+  #undef gho_vector_T_is_negative_
+  #undef gho_vector_T_abs_
+#endif
+#ifdef gho_T_gcd
+  #undef gho_T_gcd
+#endif
+#ifdef gho_T_lcm
+  #undef gho_T_lcm
+#endif
+#ifdef gho_T_pow_mod
+  #undef gho_T_pow_mod
+#endif
+#ifdef gho_T_fwrite_bin
+  #undef gho_T_fwrite_bin
+#endif
+#ifdef gho_T_fread_bin
+  #undef gho_T_fread_bin
+#endif
+#ifdef gho_T_bin_block
+  #undef gho_T_bin_block
+#endif
 #undef gho_T_copy
 #undef gho_T_equal
 #ifdef gho_T_compare
   #undef gho_T_compare
 #endif
+#ifdef gho_T_radix_key
+  #undef gho_T_radix_key
+#endif
+#ifdef gho_T_hash
+  #undef gho_T_hash
+#endif
+#undef gho_T_growth
+#undef gho_T_move
 
 #undef concat_name_helper
 #undef concat_name